@@ -41,4 +41,13 @@ static void BM_Std_FileReader(benchmark::State& state) {
 }
 BENCHMARK(BM_Std_FileReader);
 
+static void BM_Utily_FileReader_Missing(benchmark::State& state) {
+    const auto missing = std::filesystem::path { "resources/does_not_exist.ply" };
+    for (auto _ : state) {
+        auto result = Utily::FileReader::load_entire_file(missing);
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_Utily_FileReader_Missing);
+
 #endif
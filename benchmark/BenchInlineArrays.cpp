@@ -0,0 +1,90 @@
+#include "Utily/Utily.hpp"
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#if 1
+
+// Roughly a scaled up stanford bunny, xyz positions + triangle indices.
+constexpr size_t VERTEX_COUNT = size_t { 1 } << 22;
+
+static auto make_positions() -> std::vector<float> {
+    std::vector<float> v(VERTEX_COUNT * 3);
+    std::iota(v.begin(), v.end(), 0.0f);
+    return v;
+}
+static auto make_indices() -> std::vector<uint32_t> {
+    std::vector<uint32_t> v(VERTEX_COUNT * 2 * 3);
+    std::iota(v.begin(), v.end(), 0u);
+    return v;
+}
+const static std::vector<float> POSITIONS = make_positions();
+const static std::vector<uint32_t> INDICES = make_indices();
+
+static void BM_Utily_InlineArrays_alloc_copy(benchmark::State& state) {
+    for (auto _ : state) {
+        auto owner_and_spans = Utily::InlineArrays::alloc_copy(POSITIONS, INDICES);
+        benchmark::DoNotOptimize(owner_and_spans);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(POSITIONS.size() * sizeof(float) + INDICES.size() * sizeof(uint32_t)));
+}
+BENCHMARK(BM_Utily_InlineArrays_alloc_copy);
+
+static void BM_Utily_InlineArrays_alloc_copy_streaming(benchmark::State& state) {
+    const auto options = Utily::InlineArrays::BulkCopy { .non_temporal = true, .max_threads = 1 };
+    for (auto _ : state) {
+        auto owner_and_spans = Utily::InlineArrays::alloc_copy(options, POSITIONS, INDICES);
+        benchmark::DoNotOptimize(owner_and_spans);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(POSITIONS.size() * sizeof(float) + INDICES.size() * sizeof(uint32_t)));
+}
+BENCHMARK(BM_Utily_InlineArrays_alloc_copy_streaming);
+
+static void BM_Utily_InlineArrays_alloc_copy_streaming_threaded(benchmark::State& state) {
+    const auto options = Utily::InlineArrays::BulkCopy {
+        .non_temporal = true,
+        .max_threads = std::max(std::thread::hardware_concurrency(), 1u)
+    };
+    for (auto _ : state) {
+        auto owner_and_spans = Utily::InlineArrays::alloc_copy(options, POSITIONS, INDICES);
+        benchmark::DoNotOptimize(owner_and_spans);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(POSITIONS.size() * sizeof(float) + INDICES.size() * sizeof(uint32_t)));
+}
+BENCHMARK(BM_Utily_InlineArrays_alloc_copy_streaming_threaded)->UseRealTime();
+
+
+// Per-column work over the arrays of one allocation, one column at a time vs one thread per column.
+static auto normalise_column = [](auto column) {
+    using T = typename decltype(column)::value_type;
+    const T max = *std::max_element(column.begin(), column.end());
+    for (auto& v : column) {
+        v = static_cast<T>(v * 1000 / (max + 1));
+    }
+};
+
+static void BM_Utily_TupleAlgo_for_each_columns(benchmark::State& state) {
+    auto [owner, xs, ys, zs, ids] = Utily::InlineArrays::alloc_copy(POSITIONS, POSITIONS, POSITIONS, INDICES);
+    const auto columns = std::make_tuple(xs, ys, zs, ids);
+    for (auto _ : state) {
+        Utily::TupleAlgo::for_each(columns, normalise_column);
+        benchmark::DoNotOptimize(owner);
+    }
+}
+BENCHMARK(BM_Utily_TupleAlgo_for_each_columns);
+
+static void BM_Utily_TupleAlgo_parallel_for_each_columns(benchmark::State& state) {
+    auto [owner, xs, ys, zs, ids] = Utily::InlineArrays::alloc_copy(POSITIONS, POSITIONS, POSITIONS, INDICES);
+    const auto columns = std::make_tuple(xs, ys, zs, ids);
+    for (auto _ : state) {
+        Utily::TupleAlgo::parallel_for_each(columns, normalise_column);
+        benchmark::DoNotOptimize(owner);
+    }
+}
+BENCHMARK(BM_Utily_TupleAlgo_parallel_for_each_columns)->UseRealTime();
+
+#endif
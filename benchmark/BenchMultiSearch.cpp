@@ -0,0 +1,93 @@
+#include "Utily/MultiSearch.hpp"
+#include "Utily/Simd128.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if 1
+
+using namespace std::literals;
+
+namespace {
+    constexpr auto KEYWORDS = std::to_array({
+        "error"sv, "warning"sv, "fatal"sv, "timeout"sv, "refused"sv, "denied"sv, "panic"sv, "abort"sv,
+        "segfault"sv, "overflow"sv, "corrupt"sv, "retrying"sv, "unreachable"sv, "deadlock"sv, "exception"sv, "killed"sv,
+        "oom"sv, "throttled"sv, "rejected"sv, "invalid"sv, "missing"sv, "expired"sv, "failover"sv, "unavailable"sv,
+        "disconnected"sv, "checksum"sv, "mismatch"sv, "stalled"sv, "leak"sv, "crash"sv, "backtrace"sv, "assert"sv,
+        "evicted"sv, "quota"sv, "degraded"sv, "unhealthy"sv, "restarting"sv, "truncated"sv, "malformed"sv, "conflict"sv,
+        "orphaned"sv, "poisoned"sv, "starved"sv, "dropped"sv, "locked"sv, "blocked"sv, "lost"sv, "unknown"sv,
+    });
+
+    auto make_log(size_t size) -> std::string {
+        constexpr auto words = std::to_array({
+            "request"sv, "served"sv, "in"sv, "ms"sv, "user"sv, "session"sv, "started"sv, "cache"sv, "hit"sv,
+            "GET"sv, "/api/v1/items"sv, "200"sv, "OK"sv, "worker"sv, "thread"sv, "queue"sv, "depth"sv, "ok"sv,
+        });
+        std::mt19937 gen(1);
+        std::uniform_int_distribution<size_t> word(0, words.size() - 1);
+        std::uniform_int_distribution<size_t> rare(0, 199);
+        std::uniform_int_distribution<size_t> keyword(0, KEYWORDS.size() - 1);
+        std::string log;
+        while (log.size() < size) {
+            log.append(rare(gen) == 0 ? KEYWORDS[keyword(gen)] : words[word(gen)]);
+            log.push_back(rare(gen) < 10 ? '\n' : ' ');
+        }
+        return log;
+    }
+    const static std::string LOG = make_log(1 << 20);
+}
+
+static void BM_Uty_MultiSearch(benchmark::State& state) {
+    const auto keywords = std::span { KEYWORDS }.first(static_cast<size_t>(state.range(0)));
+    const auto searcher = Utily::MultiSearch(keywords);
+    for (auto _ : state) {
+        size_t count = 0;
+        searcher.for_each_match(LOG, [&](Utily::MultiSearch::Match) { ++count; });
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(LOG.size()));
+}
+BENCHMARK(BM_Uty_MultiSearch)->Arg(4)->Arg(8)->Arg(16)->Arg(20)->Arg(24)->Arg(32)->Arg(48);
+
+static void BM_Uty_MultiSearch_aho_corasick(benchmark::State& state) {
+    const auto keywords = std::span { KEYWORDS }.first(static_cast<size_t>(state.range(0)));
+    const auto searcher = Utily::MultiSearch(keywords, Utily::MultiSearch::Engine::aho_corasick);
+    for (auto _ : state) {
+        size_t count = 0;
+        searcher.for_each_match(LOG, [&](Utily::MultiSearch::Match) { ++count; });
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(LOG.size()));
+}
+BENCHMARK(BM_Uty_MultiSearch_aho_corasick)->Arg(4)->Arg(8)->Arg(16)->Arg(20)->Arg(24)->Arg(32)->Arg(48);
+
+// The old approach, one Simd128::Char::search pass over the buffer per keyword.
+static void BM_Uty_search_per_keyword(benchmark::State& state) {
+    const auto keywords = std::span { KEYWORDS }.first(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        size_t count = 0;
+        for (const auto keyword : keywords) {
+            const char* begin = LOG.data();
+            size_t remaining = LOG.size();
+            for (;;) {
+                const auto index = static_cast<size_t>(Utily::Simd128::Char::search(begin, remaining, keyword.data(), keyword.size()));
+                if (index >= remaining) {
+                    break;
+                }
+                ++count;
+                begin += index + 1;
+                remaining -= index + 1;
+            }
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(LOG.size()));
+}
+BENCHMARK(BM_Uty_search_per_keyword)->Arg(4)->Arg(8)->Arg(16)->Arg(20)->Arg(24)->Arg(32)->Arg(48);
+
+#endif
@@ -0,0 +1,90 @@
+#include "Utily/Parse.hpp"
+#include "Utily/Split.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if 1
+
+const static auto STANFORD_BUNNY_PATH = std::filesystem::path { "resources/stanford_bunny.ply" };
+
+// The vertex and face sections of the bunny's ASCII body.
+struct BunnyBody {
+    std::string text;
+    std::string_view vertices;
+    std::string_view faces;
+};
+
+const static BunnyBody BUNNY = [] {
+    BunnyBody body;
+    std::ifstream file(STANFORD_BUNNY_PATH, std::ios::binary);
+    body.text.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+    constexpr size_t vertex_count = 35947;
+    const auto text = std::string_view { body.text };
+    const size_t vertices_begin = text.find("end_header\n") + 11;
+    size_t vertices_end = vertices_begin;
+    for (size_t i = 0; i < vertex_count; ++i) {
+        vertices_end = text.find('\n', vertices_end) + 1;
+    }
+    body.vertices = text.substr(vertices_begin, vertices_end - vertices_begin);
+    body.faces = text.substr(vertices_end);
+    return body;
+}();
+
+static void BM_Utily_parse_floats_bunny(benchmark::State& state) {
+    std::vector<float> values(35947 * 5);
+    for (auto _ : state) {
+        auto count = Utily::parse_floats(BUNNY.vertices, ' ', std::span { values });
+        benchmark::DoNotOptimize(count);
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(BUNNY.vertices.size()));
+}
+BENCHMARK(BM_Utily_parse_floats_bunny);
+
+static void BM_Std_from_chars_floats_bunny(benchmark::State& state) {
+    std::vector<float> values(35947 * 5);
+    for (auto _ : state) {
+        size_t i = 0;
+        for (const auto token : Utily::split(BUNNY.vertices, ' ', '\n')) {
+            std::from_chars(token.data(), token.data() + token.size(), values[i++]);
+        }
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(BUNNY.vertices.size()));
+}
+BENCHMARK(BM_Std_from_chars_floats_bunny);
+
+static void BM_Utily_parse_ints_bunny(benchmark::State& state) {
+    std::vector<uint32_t> values(69451 * 4);
+    for (auto _ : state) {
+        auto count = Utily::parse_ints(BUNNY.faces, ' ', std::span { values });
+        benchmark::DoNotOptimize(count);
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(BUNNY.faces.size()));
+}
+BENCHMARK(BM_Utily_parse_ints_bunny);
+
+static void BM_Std_from_chars_ints_bunny(benchmark::State& state) {
+    std::vector<uint32_t> values(69451 * 4);
+    for (auto _ : state) {
+        size_t i = 0;
+        for (const auto token : Utily::split(BUNNY.faces, ' ', '\n')) {
+            std::from_chars(token.data(), token.data() + token.size(), values[i++]);
+        }
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(BUNNY.faces.size()));
+}
+BENCHMARK(BM_Std_from_chars_ints_bunny);
+
+#endif
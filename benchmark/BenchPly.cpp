@@ -0,0 +1,76 @@
+#include "Utily/Ply.hpp"
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if 1
+
+const static auto STANFORD_BUNNY_PATH = std::filesystem::path { "resources/stanford_bunny.ply" };
+
+struct NaiveMesh {
+    std::vector<float> positions;
+    std::vector<uint32_t> indices;
+};
+
+// The usual hand-written loader, assuming the bunny's header layout: x y z confidence intensity.
+static NaiveMesh naive_load(const std::filesystem::path& path) {
+    std::ifstream file(path);
+    NaiveMesh mesh;
+    size_t vertex_count = 0;
+    size_t face_count = 0;
+    for (std::string word; file >> word && word != "end_header";) {
+        if (word == "element") {
+            std::string name;
+            size_t count;
+            file >> name >> count;
+            (name == "vertex" ? vertex_count : face_count) = count;
+        }
+    }
+    mesh.positions.resize(vertex_count * 3);
+    for (size_t v = 0; v < vertex_count; ++v) {
+        float confidence, intensity;
+        file >> mesh.positions[v * 3] >> mesh.positions[v * 3 + 1] >> mesh.positions[v * 3 + 2] >> confidence >> intensity;
+    }
+    mesh.indices.resize(face_count * 3);
+    for (size_t f = 0; f < face_count; ++f) {
+        uint32_t size;
+        file >> size >> mesh.indices[f * 3] >> mesh.indices[f * 3 + 1] >> mesh.indices[f * 3 + 2];
+    }
+    return mesh;
+}
+
+static void BM_Ply_Utily(benchmark::State& state) {
+    for (auto _ : state) {
+        auto mesh = Utily::Ply::load(STANFORD_BUNNY_PATH);
+        benchmark::DoNotOptimize(mesh);
+    }
+}
+BENCHMARK(BM_Ply_Utily);
+
+static void BM_Ply_Utily_Threaded(benchmark::State& state) {
+    const auto options = Utily::Ply::Options {
+        .max_threads = std::max(std::thread::hardware_concurrency(), 1u),
+        .min_bytes_per_thread = size_t { 256 } << 10,
+    };
+    for (auto _ : state) {
+        auto mesh = Utily::Ply::load(STANFORD_BUNNY_PATH, options);
+        benchmark::DoNotOptimize(mesh);
+    }
+}
+BENCHMARK(BM_Ply_Utily_Threaded);
+
+static void BM_Ply_IfstreamExtraction(benchmark::State& state) {
+    for (auto _ : state) {
+        auto mesh = naive_load(STANFORD_BUNNY_PATH);
+        benchmark::DoNotOptimize(mesh);
+    }
+}
+BENCHMARK(BM_Ply_IfstreamExtraction);
+
+#endif
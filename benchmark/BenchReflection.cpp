@@ -0,0 +1,114 @@
+
+#include "Utily/Utily.hpp"
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#if 1
+
+namespace {
+    // Stands in for a real enum-valued field, with as many values as a typical one.
+    enum class Format : uint8_t {
+        r8,
+        rg8,
+        rgb8,
+        rgba8,
+        srgb8,
+        srgb8_alpha8,
+        r16f,
+        rg16f,
+        rgb16f,
+        rgba16f,
+        r32f,
+        rg32f,
+        rgb32f,
+        rgba32f,
+        r11g11b10f,
+        rgb10a2,
+        depth16,
+        depth24,
+        depth32f,
+        depth24_stencil8,
+        bc1,
+        bc3,
+        bc5,
+        bc7,
+    };
+
+    const std::vector<std::string_view> FORMAT_NAMES = [] {
+        std::vector<std::string_view> names;
+        for (uint32_t i = 0; i < 4096; ++i) {
+            const auto& values = Utily::Reflection::enum_values<Format>();
+            names.push_back(Utily::Reflection::enum_name(values[i * 2654435761u % values.size()]));
+        }
+        return names;
+    }();
+
+    // How enum-valued fields are typically parsed by hand.
+    auto format_from_string_if_chain(std::string_view name) -> std::optional<Format> {
+        if (name == "r8") return Format::r8;
+        if (name == "rg8") return Format::rg8;
+        if (name == "rgb8") return Format::rgb8;
+        if (name == "rgba8") return Format::rgba8;
+        if (name == "srgb8") return Format::srgb8;
+        if (name == "srgb8_alpha8") return Format::srgb8_alpha8;
+        if (name == "r16f") return Format::r16f;
+        if (name == "rg16f") return Format::rg16f;
+        if (name == "rgb16f") return Format::rgb16f;
+        if (name == "rgba16f") return Format::rgba16f;
+        if (name == "r32f") return Format::r32f;
+        if (name == "rg32f") return Format::rg32f;
+        if (name == "rgb32f") return Format::rgb32f;
+        if (name == "rgba32f") return Format::rgba32f;
+        if (name == "r11g11b10f") return Format::r11g11b10f;
+        if (name == "rgb10a2") return Format::rgb10a2;
+        if (name == "depth16") return Format::depth16;
+        if (name == "depth24") return Format::depth24;
+        if (name == "depth32f") return Format::depth32f;
+        if (name == "depth24_stencil8") return Format::depth24_stencil8;
+        if (name == "bc1") return Format::bc1;
+        if (name == "bc3") return Format::bc3;
+        if (name == "bc5") return Format::bc5;
+        if (name == "bc7") return Format::bc7;
+        return std::nullopt;
+    }
+}
+
+static void BM_Enum_FromString_IfChain(benchmark::State& state) {
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (const auto name : FORMAT_NAMES) {
+            sum += static_cast<uint64_t>(format_from_string_if_chain(name).value_or(Format::r8));
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_Enum_FromString_IfChain);
+
+static void BM_Enum_FromString_Utily(benchmark::State& state) {
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (const auto name : FORMAT_NAMES) {
+            sum += static_cast<uint64_t>(Utily::Reflection::enum_from_string<Format>(name).value_or(Format::r8));
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_Enum_FromString_Utily);
+
+static void BM_Enum_Name_Utily(benchmark::State& state) {
+    const auto& values = Utily::Reflection::enum_values<Format>();
+    for (auto _ : state) {
+        size_t sum = 0;
+        for (size_t i = 0; i < 4096; ++i) {
+            sum += Utily::Reflection::enum_name(values[i % values.size()]).size();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_Enum_Name_Utily);
+
+#endif
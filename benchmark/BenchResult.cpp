@@ -0,0 +1,243 @@
+
+#include "Utily/Utily.hpp"
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#if __has_include(<expected>)
+#include <expected>
+#endif
+
+#if 1
+
+namespace {
+    enum class ParseCode : uint8_t {
+        empty,
+        not_a_digit,
+        out_of_range,
+    };
+
+    // The layout Result had before, kept to measure against.
+    using NestedOptionals = std::variant<std::optional<uint32_t>, std::optional<ParseCode>>;
+
+    const std::vector<std::string> TOKENS = [] {
+        std::vector<std::string> tokens;
+        for (uint32_t i = 0; i < 4096; ++i) {
+            tokens.push_back(i % 64 == 0 ? std::string("12x") : std::to_string(i * 2654435761u % 100000));
+        }
+        return tokens;
+    }();
+
+    // noinline so the cost of handing the result back through the ABI is measured.
+    [[gnu::noinline]] auto parse_code(std::string_view token, uint32_t& out) -> ParseCode* {
+        static ParseCode codes[] = { ParseCode::empty, ParseCode::not_a_digit };
+        if (token.empty()) {
+            return &codes[0];
+        }
+        uint32_t value = 0;
+        for (char c : token) {
+            if (c < '0' || c > '9') {
+                return &codes[1];
+            }
+            value = value * 10 + static_cast<uint32_t>(c - '0');
+        }
+        out = value;
+        return nullptr;
+    }
+
+    template <typename R>
+    auto fail(ParseCode code) -> R {
+#if defined(__cpp_lib_expected)
+        if constexpr (std::same_as<R, std::expected<uint32_t, ParseCode>>) {
+            return std::unexpected { code };
+        } else
+#endif
+        if constexpr (std::same_as<R, NestedOptionals>) {
+            return std::optional { code };
+        } else {
+            return code;
+        }
+    }
+
+    template <typename R>
+    [[gnu::noinline]] auto parse(std::string_view token) -> R {
+        if (token.empty()) {
+            return fail<R>(ParseCode::empty);
+        }
+        uint32_t value = 0;
+        for (char c : token) {
+            if (c < '0' || c > '9') {
+                return fail<R>(ParseCode::not_a_digit);
+            }
+            value = value * 10 + static_cast<uint32_t>(c - '0');
+        }
+        if constexpr (std::same_as<R, NestedOptionals>) {
+            return std::optional { value };
+        } else {
+            return value;
+        }
+    }
+
+    auto checked(uint32_t value) -> Utily::Result<uint32_t, ParseCode> {
+        if (value > 90000) {
+            return ParseCode::out_of_range;
+        }
+        return value;
+    }
+}
+
+static void BM_Result_RawCode(benchmark::State& state) {
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (const auto& token : TOKENS) {
+            uint32_t value;
+            if (parse_code(token, value) == nullptr) {
+                sum += value;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_Result_RawCode);
+
+static void BM_Result_Utily(benchmark::State& state) {
+    static_assert(sizeof(Utily::Result<uint32_t, ParseCode>) == 8);
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (const auto& token : TOKENS) {
+            auto result = parse<Utily::Result<uint32_t, ParseCode>>(token);
+            if (result.has_value()) {
+                sum += result.value();
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_Result_Utily);
+
+static void BM_Result_NestedOptionals(benchmark::State& state) {
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (const auto& token : TOKENS) {
+            auto result = parse<NestedOptionals>(token);
+            if (std::holds_alternative<std::optional<uint32_t>>(result)) {
+                sum += *std::get<std::optional<uint32_t>>(result);
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_Result_NestedOptionals);
+
+#if defined(__cpp_lib_expected)
+static void BM_Result_StdExpected(benchmark::State& state) {
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (const auto& token : TOKENS) {
+            auto result = parse<std::expected<uint32_t, ParseCode>>(token);
+            if (result.has_value()) {
+                sum += *result;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_Result_StdExpected);
+#endif
+
+static void BM_Result_Chained(benchmark::State& state) {
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (const auto& token : TOKENS) {
+            sum += parse<Utily::Result<uint32_t, ParseCode>>(token)
+                       .and_then(checked)
+                       .transform([](uint32_t value) { return value * 3; })
+                       .value_or(0);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_Result_Chained);
+
+static void BM_Result_Branches(benchmark::State& state) {
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (const auto& token : TOKENS) {
+            auto parsed = parse<Utily::Result<uint32_t, ParseCode>>(token);
+            if (parsed.has_value()) {
+                auto valid = checked(parsed.value());
+                if (valid.has_value()) {
+                    sum += valid.value() * 3;
+                }
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_Result_Branches);
+
+constexpr size_t BATCH_SIZE = 1 << 16;
+
+static void BM_ResultBatch_Scan(benchmark::State& state) {
+    Utily::ResultBatch<uint64_t> batch;
+    for (size_t i = 0; i < BATCH_SIZE; ++i) {
+        if (i % 1000 == 0) {
+            batch.push_error(Utily::Error { Utily::Error::Code::file_not_found, i });
+        } else {
+            batch.push_back(uint64_t { i });
+        }
+    }
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (const auto value : batch) {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_ResultBatch_Scan);
+
+static void BM_VectorOfResults_Scan(benchmark::State& state) {
+    std::vector<Utily::Result<uint64_t, Utily::Error>> results;
+    for (size_t i = 0; i < BATCH_SIZE; ++i) {
+        if (i % 1000 == 0) {
+            results.emplace_back(Utily::Error { Utily::Error::Code::file_not_found, i });
+        } else {
+            results.emplace_back(uint64_t { i });
+        }
+    }
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (const auto& result : results) {
+            if (result.has_value()) {
+                sum += result.value();
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_VectorOfResults_Scan);
+
+static void BM_Vector_Scan(benchmark::State& state) {
+    std::vector<uint64_t> values;
+    for (size_t i = 0; i < BATCH_SIZE; ++i) {
+        if (i % 1000 != 0) {
+            values.push_back(i);
+        }
+    }
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (const auto value : values) {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_Vector_Scan);
+
+#endif
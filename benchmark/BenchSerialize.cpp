@@ -0,0 +1,77 @@
+
+#include "Utily/Utily.hpp"
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if 1
+
+namespace {
+    struct Vertex {
+        float x;
+        float y;
+        float z;
+        uint32_t colour;
+    };
+
+    struct Mesh {
+        std::string name;
+        std::vector<Vertex> vertices;
+        std::vector<uint32_t> indices;
+    };
+
+    struct MeshView {
+        std::string_view name;
+        std::span<const Vertex> vertices;
+        std::span<const uint32_t> indices;
+    };
+
+    const Mesh MESH = [] {
+        Mesh mesh { "bunny", {}, {} };
+        for (uint32_t i = 0; i < (1 << 16); ++i) {
+            mesh.vertices.push_back(Vertex { static_cast<float>(i), 0.5f, 0.25f, i });
+            mesh.indices.push_back(i * 3 % (1 << 16));
+        }
+        return mesh;
+    }();
+
+    const std::vector<uint8_t> MESH_BYTES = [] {
+        std::vector<uint8_t> bytes;
+        Utily::serialize(MESH, bytes);
+        return bytes;
+    }();
+}
+
+static void BM_Serialize_Mesh(benchmark::State& state) {
+    std::vector<uint8_t> bytes;
+    for (auto _ : state) {
+        bytes.clear();
+        Utily::serialize(MESH, bytes);
+        benchmark::DoNotOptimize(bytes.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(MESH_BYTES.size()));
+}
+BENCHMARK(BM_Serialize_Mesh);
+
+static void BM_Deserialize_MeshCopy(benchmark::State& state) {
+    for (auto _ : state) {
+        auto mesh = Utily::deserialize<Mesh>(MESH_BYTES);
+        benchmark::DoNotOptimize(mesh.value().vertices.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(MESH_BYTES.size()));
+}
+BENCHMARK(BM_Deserialize_MeshCopy);
+
+static void BM_Deserialize_MeshView(benchmark::State& state) {
+    for (auto _ : state) {
+        auto mesh = Utily::deserialize<MeshView>(MESH_BYTES);
+        benchmark::DoNotOptimize(mesh.value().vertices.data());
+    }
+}
+BENCHMARK(BM_Deserialize_MeshView);
+
+#endif
@@ -1,7 +1,9 @@
 #include "Utily/Utily.hpp"
 
+#include "Utily/Simd.hpp"
 #include "Utily/Simd128.hpp"
 #include "Utily/Simd512.hpp"
+#include "Utily/Validate.hpp"
 
 #include <benchmark/benchmark.h>
 
@@ -74,6 +76,44 @@ static void BM_Std_find_first_of_chars(benchmark::State& state) {
 }
 BENCHMARK(BM_Std_find_first_of_chars);
 
+// Delimiters that only appear in LONG_STRING's "stringer" tail.
+constexpr static std::string_view DELIMS_16 = "zrq,;:{}[]\"\\/\t\n\r";
+
+template <size_t N>
+static void BM_Uty_find_first_of_char_per_delim(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto iter = Utily::Simd128::Char::find_first_of<N>(LONG_STRING.data(), LONG_STRING.size(), DELIMS_16.data());
+        benchmark::DoNotOptimize(iter);
+    }
+}
+BENCHMARK(BM_Uty_find_first_of_char_per_delim<4>);
+BENCHMARK(BM_Uty_find_first_of_char_per_delim<8>);
+BENCHMARK(BM_Uty_find_first_of_char_per_delim<16>);
+
+template <size_t N>
+static void BM_Uty_find_first_of_char_charset(benchmark::State& state) {
+    const auto set = Utily::Simd128::Char::CharSet { DELIMS_16.substr(0, N) };
+    for (auto _ : state) {
+        volatile auto iter = Utily::Simd128::Char::find_first_of(LONG_STRING.data(), LONG_STRING.size(), set);
+        benchmark::DoNotOptimize(iter);
+    }
+}
+BENCHMARK(BM_Uty_find_first_of_char_charset<4>);
+BENCHMARK(BM_Uty_find_first_of_char_charset<8>);
+BENCHMARK(BM_Uty_find_first_of_char_charset<16>);
+
+template <size_t N>
+static void BM_Uty_find_first_of_char_charset_512(benchmark::State& state) {
+    const auto set = Utily::Simd512::Char::CharSet { DELIMS_16.substr(0, N) };
+    for (auto _ : state) {
+        volatile auto iter = Utily::Simd512::Char::find_first_of(LONG_STRING.data(), LONG_STRING.size(), set);
+        benchmark::DoNotOptimize(iter);
+    }
+}
+BENCHMARK(BM_Uty_find_first_of_char_charset_512<4>);
+BENCHMARK(BM_Uty_find_first_of_char_charset_512<8>);
+BENCHMARK(BM_Uty_find_first_of_char_charset_512<16>);
+
 static void BM_Uty_search_char_4letters(benchmark::State& state) {
     std::string_view find = "stri";
     for (auto _ : state) {
@@ -139,4 +179,523 @@ static void BM_Std_search_char_8letters(benchmark::State& state) {
 }
 BENCHMARK(BM_Std_search_char_8letters);
 
+// The suffix of LONG_STRING, found once at the very end.
+static auto suffix_needle(size_t length) -> std::string_view {
+    return std::string_view { LONG_STRING }.substr(LONG_STRING.size() - length);
+}
+// First and last bytes match every position of LONG_STRING, worst case for the first/last byte filter.
+static auto adversarial_needle(size_t length) -> std::string {
+    std::string needle(length, 'b');
+    needle.front() = 'a';
+    needle.back() = 'a';
+    return needle;
+}
+
+static void BM_Uty_search_char_any_length(benchmark::State& state) {
+    const auto needle = suffix_needle(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        volatile auto index = Utily::Simd128::Char::search(LONG_STRING.data(), LONG_STRING.size(), needle.data(), needle.size());
+        benchmark::DoNotOptimize(index);
+    }
+}
+BENCHMARK(BM_Uty_search_char_any_length)->DenseRange(2, 8)->RangeMultiplier(2)->Range(16, 64);
+
+static void BM_Uty_search_char_any_length_512(benchmark::State& state) {
+    const auto needle = suffix_needle(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        volatile auto index = Utily::Simd512::Char::search(LONG_STRING.data(), LONG_STRING.size(), needle.data(), needle.size());
+        benchmark::DoNotOptimize(index);
+    }
+}
+BENCHMARK(BM_Uty_search_char_any_length_512)->DenseRange(2, 8)->RangeMultiplier(2)->Range(16, 64);
+
+static void BM_Std_search_char_any_length(benchmark::State& state) {
+    const auto needle = suffix_needle(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        volatile auto iter = std::search(LONG_STRING.begin(), LONG_STRING.end(), needle.begin(), needle.end());
+        benchmark::DoNotOptimize(iter);
+    }
+}
+BENCHMARK(BM_Std_search_char_any_length)->DenseRange(2, 8)->RangeMultiplier(2)->Range(16, 64);
+
+static void BM_Uty_search_char_adversarial(benchmark::State& state) {
+    const auto needle = adversarial_needle(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        volatile auto index = Utily::Simd128::Char::search_first_last(LONG_STRING.data(), LONG_STRING.size(), needle.data(), needle.size());
+        benchmark::DoNotOptimize(index);
+    }
+}
+BENCHMARK(BM_Uty_search_char_adversarial)->RangeMultiplier(2)->Range(2, 64);
+
+static void BM_Uty_search_char_adversarial_512(benchmark::State& state) {
+    const auto needle = adversarial_needle(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        volatile auto index = Utily::Simd512::Char::search_first_last(LONG_STRING.data(), LONG_STRING.size(), needle.data(), needle.size());
+        benchmark::DoNotOptimize(index);
+    }
+}
+BENCHMARK(BM_Uty_search_char_adversarial_512)->RangeMultiplier(2)->Range(2, 64);
+
+static void BM_Std_search_char_adversarial(benchmark::State& state) {
+    const auto needle = adversarial_needle(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        volatile auto iter = std::search(LONG_STRING.begin(), LONG_STRING.end(), needle.begin(), needle.end());
+        benchmark::DoNotOptimize(iter);
+    }
+}
+BENCHMARK(BM_Std_search_char_adversarial)->RangeMultiplier(2)->Range(2, 64);
+
+// LONG_STRING with the only match at the front, so reverse scans cross the whole buffer.
+const static std::string REVERSE_STRING = "stringer" + LONG_STRING.substr(0, LONG_STRING.size() - 8);
+
+static void BM_Uty_rfind_char(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto index = Utily::Simd128::Char::rfind(REVERSE_STRING.data(), REVERSE_STRING.size(), 'g');
+        benchmark::DoNotOptimize(index);
+    }
+}
+BENCHMARK(BM_Uty_rfind_char);
+
+static void BM_Uty_rfind_char_512(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto index = Utily::Simd512::Char::rfind(REVERSE_STRING.data(), REVERSE_STRING.size(), 'g');
+        benchmark::DoNotOptimize(index);
+    }
+}
+BENCHMARK(BM_Uty_rfind_char_512);
+
+static void BM_Std_rfind_char(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto iter = std::find(REVERSE_STRING.rbegin(), REVERSE_STRING.rend(), 'g');
+        benchmark::DoNotOptimize(iter);
+    }
+}
+BENCHMARK(BM_Std_rfind_char);
+
+static void BM_Uty_find_last_of_char(benchmark::State& state) {
+    const auto set = Utily::Simd128::Char::CharSet { DELIMS_16.data(), 4 };
+    for (auto _ : state) {
+        volatile auto index = Utily::Simd128::Char::find_last_of(REVERSE_STRING.data(), REVERSE_STRING.size(), set);
+        benchmark::DoNotOptimize(index);
+    }
+}
+BENCHMARK(BM_Uty_find_last_of_char);
+
+static void BM_Uty_find_last_of_char_512(benchmark::State& state) {
+    const auto set = Utily::Simd512::Char::CharSet { DELIMS_16.data(), 4 };
+    for (auto _ : state) {
+        volatile auto index = Utily::Simd512::Char::find_last_of(REVERSE_STRING.data(), REVERSE_STRING.size(), set);
+        benchmark::DoNotOptimize(index);
+    }
+}
+BENCHMARK(BM_Uty_find_last_of_char_512);
+
+static void BM_Std_find_last_of_char(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto index = std::string_view { REVERSE_STRING }.find_last_of(DELIMS_16.substr(0, 4));
+        benchmark::DoNotOptimize(index);
+    }
+}
+BENCHMARK(BM_Std_find_last_of_char);
+
+static void BM_Uty_rsearch_char(benchmark::State& state) {
+    const auto needle = std::string_view { "stringer" };
+    for (auto _ : state) {
+        volatile auto index = Utily::Simd128::Char::rsearch(REVERSE_STRING.data(), REVERSE_STRING.size(), needle.data(), needle.size());
+        benchmark::DoNotOptimize(index);
+    }
+}
+BENCHMARK(BM_Uty_rsearch_char);
+
+static void BM_Uty_rsearch_char_512(benchmark::State& state) {
+    const auto needle = std::string_view { "stringer" };
+    for (auto _ : state) {
+        volatile auto index = Utily::Simd512::Char::rsearch(REVERSE_STRING.data(), REVERSE_STRING.size(), needle.data(), needle.size());
+        benchmark::DoNotOptimize(index);
+    }
+}
+BENCHMARK(BM_Uty_rsearch_char_512);
+
+static void BM_Std_rsearch_char(benchmark::State& state) {
+    const auto needle = std::string_view { "stringer" };
+    for (auto _ : state) {
+        volatile auto iter = std::find_end(REVERSE_STRING.begin(), REVERSE_STRING.end(), needle.begin(), needle.end());
+        benchmark::DoNotOptimize(iter);
+    }
+}
+BENCHMARK(BM_Std_rsearch_char);
+
+// What the icase kernels replace, lowercasing a copy of the source for every lookup.
+static auto lower_copy(std::string_view src) -> std::string {
+    std::string lower { src };
+    std::ranges::transform(lower, lower.begin(), [](char c) { return (c >= 'A' && c <= 'Z') ? static_cast<char>(c | 0x20) : c; });
+    return lower;
+}
+
+static void BM_Uty_search_icase_char(benchmark::State& state) {
+    const auto needle = std::string_view { "STRINGER" };
+    for (auto _ : state) {
+        volatile auto index = Utily::Simd128::Char::search_icase(LONG_STRING.data(), LONG_STRING.size(), needle.data(), needle.size());
+        benchmark::DoNotOptimize(index);
+    }
+}
+BENCHMARK(BM_Uty_search_icase_char);
+
+static void BM_Uty_search_icase_char_512(benchmark::State& state) {
+    const auto needle = std::string_view { "STRINGER" };
+    for (auto _ : state) {
+        volatile auto index = Utily::Simd512::Char::search_icase(LONG_STRING.data(), LONG_STRING.size(), needle.data(), needle.size());
+        benchmark::DoNotOptimize(index);
+    }
+}
+BENCHMARK(BM_Uty_search_icase_char_512);
+
+static void BM_Uty_search_lower_copy_char(benchmark::State& state) {
+    const auto needle = std::string_view { "stringer" };
+    for (auto _ : state) {
+        const auto lower = lower_copy(LONG_STRING);
+        volatile auto index = Utily::Simd128::Char::search(lower.data(), lower.size(), needle.data(), needle.size());
+        benchmark::DoNotOptimize(index);
+    }
+}
+BENCHMARK(BM_Uty_search_lower_copy_char);
+
+static void BM_Uty_find_icase_char(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto index = Utily::Simd128::Char::find_icase(LONG_STRING.data(), LONG_STRING.size(), 'Z');
+        benchmark::DoNotOptimize(index);
+    }
+}
+BENCHMARK(BM_Uty_find_icase_char);
+
+static void BM_Uty_find_first_digit_char(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto index = Utily::Simd128::Char::find_first_digit(LONG_STRING.data(), LONG_STRING.size());
+        benchmark::DoNotOptimize(index);
+    }
+}
+BENCHMARK(BM_Uty_find_first_digit_char);
+
+static void BM_Uty_find_first_digit_char_512(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto index = Utily::Simd512::Char::find_first_digit(LONG_STRING.data(), LONG_STRING.size());
+        benchmark::DoNotOptimize(index);
+    }
+}
+BENCHMARK(BM_Uty_find_first_digit_char_512);
+
+static void BM_Std_find_first_digit_char(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto iter = std::ranges::find_if(LONG_STRING, [](char c) { return c >= '0' && c <= '9'; });
+        benchmark::DoNotOptimize(iter);
+    }
+}
+BENCHMARK(BM_Std_find_first_digit_char);
+
+static void BM_Uty_find_first_non_ascii_char(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto index = Utily::Simd128::Char::find_first_non_ascii(LONG_STRING.data(), LONG_STRING.size());
+        benchmark::DoNotOptimize(index);
+    }
+}
+BENCHMARK(BM_Uty_find_first_non_ascii_char);
+
+template <typename T>
+auto iota_as(size_t max) -> std::vector<T> {
+    std::vector<T> v(max);
+    std::iota(v.begin(), v.end(), T { 0 });
+    return v;
+}
+const static std::vector<uint16_t> IDS_16 = iota_as<uint16_t>(10000);
+const static std::vector<uint64_t> IDS_64 = iota_as<uint64_t>(10000);
+const static std::vector<float> FLOATS = iota_as<float>(10000);
+const static std::vector<double> DOUBLES = iota_as<double>(10000);
+const static std::vector<int32_t> INTS = iota_as<int32_t>(10000);
+
+static void BM_Uty_find_u16(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto index = Utily::Simd128::U16::find(IDS_16.data(), IDS_16.size(), uint16_t { 9999 });
+        benchmark::DoNotOptimize(index);
+    }
+}
+BENCHMARK(BM_Uty_find_u16);
+
+static void BM_Std_find_u16(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto iter = std::find(IDS_16.begin(), IDS_16.end(), uint16_t { 9999 });
+        benchmark::DoNotOptimize(iter);
+    }
+}
+BENCHMARK(BM_Std_find_u16);
+
+static void BM_Uty_find_i32(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto iter = Utily::Simd::find(NUMS.begin(), NUMS.end(), int32_t { 9999 });
+        benchmark::DoNotOptimize(iter);
+    }
+}
+BENCHMARK(BM_Uty_find_i32);
+
+static void BM_Std_find_i32(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto iter = std::find(NUMS.begin(), NUMS.end(), int32_t { 9999 });
+        benchmark::DoNotOptimize(iter);
+    }
+}
+BENCHMARK(BM_Std_find_i32);
+
+static void BM_Uty_count_u64(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto count = Utily::Simd128::U64::count(IDS_64.data(), IDS_64.size(), uint64_t { 5000 });
+        benchmark::DoNotOptimize(count);
+    }
+}
+BENCHMARK(BM_Uty_count_u64);
+
+static void BM_Std_count_u64(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto count = std::count(IDS_64.begin(), IDS_64.end(), uint64_t { 5000 });
+        benchmark::DoNotOptimize(count);
+    }
+}
+BENCHMARK(BM_Std_count_u64);
+
+static void BM_Uty_find_if_greater_f32(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto index = Utily::Simd128::F32::find_if_greater(FLOATS.data(), FLOATS.size(), 9998.5f);
+        benchmark::DoNotOptimize(index);
+    }
+}
+BENCHMARK(BM_Uty_find_if_greater_f32);
+
+static void BM_Std_find_if_greater_f32(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto iter = std::find_if(FLOATS.begin(), FLOATS.end(), [](float f) { return f > 9998.5f; });
+        benchmark::DoNotOptimize(iter);
+    }
+}
+BENCHMARK(BM_Std_find_if_greater_f32);
+
+static void BM_Uty_max_u64(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto max = Utily::Simd128::U64::max(IDS_64.data(), IDS_64.size());
+        benchmark::DoNotOptimize(max);
+    }
+}
+BENCHMARK(BM_Uty_max_u64);
+
+static void BM_Std_max_u64(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto max = *std::max_element(IDS_64.begin(), IDS_64.end());
+        benchmark::DoNotOptimize(max);
+    }
+}
+BENCHMARK(BM_Std_max_u64);
+
+static void BM_Uty_minmax_f32(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto min = Utily::Simd128::F32::minmax(FLOATS.data(), FLOATS.size()).min;
+        benchmark::DoNotOptimize(min);
+    }
+}
+BENCHMARK(BM_Uty_minmax_f32);
+
+static void BM_Uty_minmax_f32_512(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto min = Utily::Simd512::F32::minmax(FLOATS.data(), FLOATS.size()).min;
+        benchmark::DoNotOptimize(min);
+    }
+}
+BENCHMARK(BM_Uty_minmax_f32_512);
+
+static void BM_Std_minmax_f32(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto min = *std::minmax_element(FLOATS.begin(), FLOATS.end()).first;
+        benchmark::DoNotOptimize(min);
+    }
+}
+BENCHMARK(BM_Std_minmax_f32);
+
+static void BM_Uty_argmax_i32(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto index = Utily::Simd128::I32::argmax(INTS.data(), INTS.size());
+        benchmark::DoNotOptimize(index);
+    }
+}
+BENCHMARK(BM_Uty_argmax_i32);
+
+static void BM_Uty_argmax_i32_512(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto index = Utily::Simd512::I32::argmax(INTS.data(), INTS.size());
+        benchmark::DoNotOptimize(index);
+    }
+}
+BENCHMARK(BM_Uty_argmax_i32_512);
+
+static void BM_Std_argmax_i32(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto iter = std::max_element(INTS.begin(), INTS.end());
+        benchmark::DoNotOptimize(iter);
+    }
+}
+BENCHMARK(BM_Std_argmax_i32);
+
+static void BM_Uty_argmin_f64(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto index = Utily::Simd128::F64::argmin(DOUBLES.data(), DOUBLES.size());
+        benchmark::DoNotOptimize(index);
+    }
+}
+BENCHMARK(BM_Uty_argmin_f64);
+
+static void BM_Uty_argmin_f64_512(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto index = Utily::Simd512::F64::argmin(DOUBLES.data(), DOUBLES.size());
+        benchmark::DoNotOptimize(index);
+    }
+}
+BENCHMARK(BM_Uty_argmin_f64_512);
+
+static void BM_Std_argmin_f64(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto iter = std::min_element(DOUBLES.begin(), DOUBLES.end());
+        benchmark::DoNotOptimize(iter);
+    }
+}
+BENCHMARK(BM_Std_argmin_f64);
+
+static void BM_Uty_sum_i32(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto sum = Utily::Simd128::I32::sum(INTS.data(), INTS.size());
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_Uty_sum_i32);
+
+static void BM_Uty_sum_i32_512(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto sum = Utily::Simd512::I32::sum(INTS.data(), INTS.size());
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_Uty_sum_i32_512);
+
+static void BM_Std_sum_i32(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto sum = std::accumulate(INTS.begin(), INTS.end(), int64_t { 0 });
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_Std_sum_i32);
+
+static void BM_Uty_sum_f64_fast(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto sum = Utily::Simd128::F64::sum(DOUBLES.data(), DOUBLES.size(), Utily::Simd128::Summation::fast);
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_Uty_sum_f64_fast);
+
+static void BM_Uty_sum_f64_fast_512(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto sum = Utily::Simd512::F64::sum(DOUBLES.data(), DOUBLES.size(), Utily::Simd512::Summation::fast);
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_Uty_sum_f64_fast_512);
+
+static void BM_Uty_sum_f64_pairwise(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto sum = Utily::Simd128::F64::sum(DOUBLES.data(), DOUBLES.size(), Utily::Simd128::Summation::pairwise);
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_Uty_sum_f64_pairwise);
+
+static void BM_Uty_sum_f64_pairwise_512(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto sum = Utily::Simd512::F64::sum(DOUBLES.data(), DOUBLES.size(), Utily::Simd512::Summation::pairwise);
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_Uty_sum_f64_pairwise_512);
+
+static void BM_Uty_sum_f64_kahan(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto sum = Utily::Simd128::F64::sum(DOUBLES.data(), DOUBLES.size(), Utily::Simd128::Summation::kahan);
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_Uty_sum_f64_kahan);
+
+static void BM_Uty_sum_f64_kahan_512(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto sum = Utily::Simd512::F64::sum(DOUBLES.data(), DOUBLES.size(), Utily::Simd512::Summation::kahan);
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_Uty_sum_f64_kahan_512);
+
+static void BM_Std_sum_f64(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto sum = std::accumulate(DOUBLES.begin(), DOUBLES.end(), 0.0);
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_Std_sum_f64);
+
+const static std::string UTF8_TEXT = [] {
+    std::string s;
+    while (s.size() < 1'000'000) {
+        s += "The price is 5\xE2\x82\xAC, caf\xC3\xA9 au lait \xF0\x9F\x98\x80. Plain ASCII makes up most lines.\n";
+    }
+    return s;
+}();
+
+static void BM_Uty_validate_utf8(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto valid = Utily::Simd128::Char::validate_utf8(UTF8_TEXT).has_value();
+        benchmark::DoNotOptimize(valid);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(UTF8_TEXT.size()));
+}
+BENCHMARK(BM_Uty_validate_utf8);
+
+static void BM_Uty_validate_utf8_512(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto valid = Utily::Simd512::Char::validate_utf8(UTF8_TEXT).has_value();
+        benchmark::DoNotOptimize(valid);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(UTF8_TEXT.size()));
+}
+BENCHMARK(BM_Uty_validate_utf8_512);
+
+static void BM_Scalar_validate_utf8(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto offset = Utily::Simd128::Char::Details::find_first_invalid_utf8_scalar(
+            reinterpret_cast<const uint8_t*>(UTF8_TEXT.data()), UTF8_TEXT.size(), 0);
+        benchmark::DoNotOptimize(offset);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(UTF8_TEXT.size()));
+}
+BENCHMARK(BM_Scalar_validate_utf8);
+
+static void BM_Uty_is_ascii(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto ascii = Utily::Simd512::Char::is_ascii(LONG_STRING).has_value();
+        benchmark::DoNotOptimize(ascii);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(LONG_STRING.size()));
+}
+BENCHMARK(BM_Uty_is_ascii);
+
+static void BM_Std_is_ascii(benchmark::State& state) {
+    for (auto _ : state) {
+        volatile auto ascii = std::ranges::all_of(LONG_STRING, [](char c) { return static_cast<uint8_t>(c) < 0x80; });
+        benchmark::DoNotOptimize(ascii);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(LONG_STRING.size()));
+}
+BENCHMARK(BM_Std_is_ascii);
+
 #endif
\ No newline at end of file
@@ -2,7 +2,10 @@
 #include "Utily/Utily.hpp"
 #include <benchmark/benchmark.h>
 
+#include <charconv>
 #include <ranges>
+#include <string_view>
+#include <vector>
 
 #if 1
 
@@ -37,4 +40,69 @@ static void BM_Std_SplitByElement(benchmark::State& state) {
 }
 BENCHMARK(BM_Std_SplitByElement);
 
+static void BM_Utily_RSplitByElement(benchmark::State& state) {
+    for (auto _ : state) {
+        for (auto word : Utily::rsplit(LONG_STRING, ' ')) {
+            benchmark::DoNotOptimize(word);
+        }
+    }
+}
+BENCHMARK(BM_Utily_RSplitByElement);
+
+// Only the last line, the common tail-of-a-log case.
+static void BM_Utily_RSplitLastToken(benchmark::State& state) {
+    for (auto _ : state) {
+        auto word = *Utily::rsplit(LONG_STRING, ',').begin();
+        benchmark::DoNotOptimize(word);
+    }
+}
+BENCHMARK(BM_Utily_RSplitLastToken);
+
+static void BM_Std_RSplitLastToken(benchmark::State& state) {
+    for (auto _ : state) {
+        auto last = std::find(LONG_STRING.rbegin(), LONG_STRING.rend(), ',').base();
+        auto word = std::string_view { last, LONG_STRING.end() };
+        benchmark::DoNotOptimize(word);
+    }
+}
+BENCHMARK(BM_Std_RSplitLastToken);
+
+static const std::string NUMBER_LINES = [] {
+    std::string lines;
+    for (int i = 0; i < 100000; ++i) {
+        lines += std::to_string(i * 7919 % 1000003) + '\n';
+    }
+    return lines;
+}();
+
+static auto to_int(std::string_view token) -> int {
+    int value = 0;
+    std::from_chars(token.data(), token.data() + token.size(), value);
+    return value;
+}
+
+static void BM_Utily_SplitTransformCollect(benchmark::State& state) {
+    std::vector<int> values;
+    for (auto _ : state) {
+        values.clear();
+        auto count = Utily::split(NUMBER_LINES, '\n') | Utily::transform(to_int) | Utily::collect_into(values);
+        benchmark::DoNotOptimize(count);
+        benchmark::DoNotOptimize(values.data());
+    }
+}
+BENCHMARK(BM_Utily_SplitTransformCollect);
+
+static void BM_Utily_SplitEvaluateThenConvert(benchmark::State& state) {
+    std::vector<int> values;
+    for (auto _ : state) {
+        values.clear();
+        const auto tokens = Utily::split(NUMBER_LINES, '\n').evaluate();
+        for (auto token : tokens) {
+            values.push_back(to_int(token));
+        }
+        benchmark::DoNotOptimize(values.data());
+    }
+}
+BENCHMARK(BM_Utily_SplitEvaluateThenConvert);
+
 #endif
\ No newline at end of file
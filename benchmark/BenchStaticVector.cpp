@@ -107,4 +107,70 @@ static void BM_Array_Iterate(benchmark::State& state) {
 }
 BENCHMARK(BM_Array_Iterate);
 
+struct Pod {
+    float x, y, z;
+    uint32_t id;
+};
+
+static auto make_pods() {
+    std::array<Pod, N> pods;
+    for (size_t i = 0; i < N; ++i) {
+        pods[i] = Pod { static_cast<float>(i), 0.0f, 0.0f, static_cast<uint32_t>(i) };
+    }
+    return pods;
+}
+const static auto PODS = make_pods();
+
+static void BM_StaticVector_CopyPod(benchmark::State& state) {
+    Utily::StaticVector<Pod, N> v;
+    v.assign(PODS);
+    for (auto _ : state) {
+        Utily::StaticVector<Pod, N> copy = v;
+        benchmark::DoNotOptimize(copy);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_StaticVector_CopyPod);
+
+static void BM_StaticVector_AssignPod(benchmark::State& state) {
+    Utily::StaticVector<Pod, N> v;
+    for (auto _ : state) {
+        v.assign(PODS);
+        benchmark::DoNotOptimize(v);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_StaticVector_AssignPod);
+
+static void BM_StaticVector_InsertEraseFrontPod(benchmark::State& state) {
+    Utily::StaticVector<Pod, N> v;
+    v.assign(std::span { PODS }.first(N - 1));
+    for (auto _ : state) {
+        v.insert(std::as_const(v).begin(), PODS.front());
+        v.erase(std::as_const(v).begin());
+        benchmark::DoNotOptimize(v);
+    }
+}
+BENCHMARK(BM_StaticVector_InsertEraseFrontPod);
+
+static void BM_Array_CopyPod(benchmark::State& state) {
+    std::array<Pod, N> a = PODS;
+    for (auto _ : state) {
+        std::array<Pod, N> copy = a;
+        benchmark::DoNotOptimize(copy);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_Array_CopyPod);
+
+static void BM_Vector_InsertEraseFrontPod(benchmark::State& state) {
+    std::vector<Pod> v(PODS.begin(), PODS.end() - 1);
+    for (auto _ : state) {
+        v.insert(v.begin(), PODS.front());
+        v.erase(v.begin());
+        benchmark::DoNotOptimize(v);
+    }
+}
+BENCHMARK(BM_Vector_InsertEraseFrontPod);
+
 #endif 
\ No newline at end of file
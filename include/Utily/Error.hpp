@@ -1,44 +1,233 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
 #include <source_location>
 #include <string>
 #include <string_view>
-#include <variant>
 
 namespace Utily {
+    /*
+     * A trivially copyable error: a code, the errno at the failure and a few integers (path hash, offsets,
+     * byte counts). Nothing is formatted or allocated until what() is called, which renders the message
+     * into a thread-local buffer. The returned view is valid until the next what() on the same thread.
+     */
     class Error
     {
-        std::variant<std::monostate, std::string, std::string_view> _error;
+    public:
+        enum class Code : uint8_t {
+            message,               // a static message, e.g. Error { "Not good." }.
+            file_not_found,        // path hash
+            file_open_failed,      // path hash
+            file_read_failed,      // path hash, bytes read, bytes expected
+            file_write_failed,     // path hash, bytes written, bytes expected
+            file_too_large,        // path hash, file size, largest supported size
+            file_not_queued,       // path hash
+            file_not_loaded,       // path hash
+            file_already_queued,   // path hash
+            not_implemented,
+            non_ascii,             // offset
+            invalid_utf8,          // offset
+            invalid_integer,       // offset, token as detail
+            invalid_float,         // offset, token as detail
+            too_many_integers,     // offset, capacity
+            too_many_floats,       // offset, capacity
+            serialized_truncated,  // offset, bytes needed, bytes remaining
+            serialized_mismatch,   // expected header or schema, found
+            serialized_misaligned, // offset, alignment
+            serialized_too_large,  // offset, element count, capacity
+            ply_invalid_header,    // offset, line as detail
+            ply_unsupported,       // offset, feature as detail
+            ply_value_count,       // offset, values per line
+            ply_truncated,         // offset, bytes needed, bytes remaining
+            ply_invalid_index,     // face, index, vertex count
+        };
+
+        constexpr static size_t detail_capacity = 15;
+
+    private:
+        union {
+            std::string_view _message;
+            std::array<char, detail_capacity> _detail;
+        };
+        std::array<uint64_t, 3> _values {};
+        int32_t _errno = 0;
+        Code _code;
+        uint8_t _detail_size = 0;
 
     public:
         constexpr Error()
-            : _error(std::monostate {}) { }
+            : _message("Undefined error")
+            , _code(Code::message) { }
 
-        constexpr Error(const std::string& message)
-            : _error(message) { }
-        constexpr Error(std::string&& message)
-            : _error(std::forward<std::string>(message)) { }
+        // The message isn't copied, it must outlive the Error (string literals do).
+        constexpr Error(const std::string_view message)
+            : _message(message)
+            , _code(Code::message) { }
+        constexpr Error(const char* message)
+            : _message(message)
+            , _code(Code::message) { }
+        // A std::string would convert to the string_view above and dangle once it goes away.
+        Error(const std::string& message) = delete;
+        Error(std::string&& message) = delete;
 
-        constexpr Error(const std::string_view& message)
-            : _error(message) { }
-        constexpr Error(std::string_view&& message)
-            : _error(std::forward<std::string_view>(message)) { }
+        constexpr Error(const Code code, const uint64_t first = 0, const uint64_t second = 0, const uint64_t third = 0)
+            : _detail {}
+            , _values { first, second, third }
+            , _code(code) { }
 
-        constexpr Error(const char* message)
-            : _error(std::string_view { message }) { }
-
-        constexpr auto what() const noexcept -> std::string_view {
-            auto get_error_msg = []<typename T>(const T& error) {
-                if constexpr (std::same_as<T, std::string>) {
-                    return std::string_view { error };
-                } else if constexpr (std::same_as<T, std::string_view>) {
-                    return error;
-                } else {
-                    return std::string_view { "Undefined error" };
-                }
-            };
-            return std::visit(get_error_msg, _error);
+        // Attaches errno, typically captured straight after the failing call.
+        [[nodiscard]] constexpr auto with_errno(const int error_number) noexcept -> Error& {
+            _errno = error_number;
+            return *this;
         }
+
+        // Attaches a short piece of text, e.g. the token that failed to parse. Truncated to detail_capacity.
+        [[nodiscard]] constexpr auto with_detail(const std::string_view detail) noexcept -> Error& {
+            if (_code != Code::message) {
+                // One past the capacity marks a truncated detail.
+                _detail_size = static_cast<uint8_t>(std::min(detail.size(), detail_capacity + 1));
+                std::copy_n(detail.begin(), std::min(detail.size(), detail_capacity), _detail.begin());
+            }
+            return *this;
+        }
+
+        [[nodiscard]] constexpr auto code() const noexcept -> Code { return _code; }
+        [[nodiscard]] constexpr auto error_number() const noexcept -> int { return _errno; }
+        [[nodiscard]] constexpr auto values() const noexcept -> const std::array<uint64_t, 3>& { return _values; }
+        [[nodiscard]] constexpr auto detail() const noexcept -> std::string_view {
+            return _code == Code::message ? std::string_view {} : std::string_view { _detail.data(), std::min<size_t>(_detail_size, detail_capacity) };
+        }
+
+        [[nodiscard]] auto what() const noexcept -> std::string_view;
     };
 
+    namespace ErrorDetails {
+        class Formatter
+        {
+            std::array<char, 256> _buffer;
+            size_t _size = 0;
+
+        public:
+            auto append(const std::string_view text) noexcept -> Formatter& {
+                const size_t n = std::min(text.size(), _buffer.size() - _size);
+                std::copy_n(text.begin(), n, _buffer.begin() + static_cast<std::ptrdiff_t>(_size));
+                _size += n;
+                return *this;
+            }
+            auto append(const uint64_t value, const int base = 10) noexcept -> Formatter& {
+                std::array<char, 24> digits;
+                const auto end = std::to_chars(digits.data(), digits.data() + digits.size(), value, base).ptr;
+                return append(std::string_view { digits.data(), end });
+            }
+            auto append_path(const uint64_t hash) noexcept -> Formatter& {
+                return append(" (path hash 0x").append(hash, 16).append(")");
+            }
+            auto view() const noexcept -> std::string_view {
+                return { _buffer.data(), _size };
+            }
+            void clear() noexcept {
+                _size = 0;
+            }
+        };
+    }
+
+    inline auto Error::what() const noexcept -> std::string_view {
+        if (_code == Code::message) {
+            return _message;
+        }
+
+        thread_local ErrorDetails::Formatter formatter;
+        formatter.clear();
+
+        const auto [first, second, third] = _values;
+        switch (_code) {
+        case Code::file_not_found:
+            formatter.append("File does not exist").append_path(first);
+            break;
+        case Code::file_open_failed:
+            formatter.append("File could not be opened").append_path(first);
+            break;
+        case Code::file_read_failed:
+            formatter.append("File read failed after ").append(second).append(" of ").append(third).append(" bytes").append_path(first);
+            break;
+        case Code::file_write_failed:
+            formatter.append("File write failed after ").append(second).append(" of ").append(third).append(" bytes").append_path(first);
+            break;
+        case Code::file_too_large:
+            formatter.append("File of ").append(second).append(" bytes is larger than the supported ").append(third).append(" bytes").append_path(first);
+            break;
+        case Code::file_not_queued:
+            formatter.append("File was not pushed to be loaded").append_path(first);
+            break;
+        case Code::file_not_loaded:
+            formatter.append("File has not finished loading").append_path(first);
+            break;
+        case Code::file_already_queued:
+            formatter.append("File is already queued").append_path(first);
+            break;
+        case Code::not_implemented:
+            formatter.append("Not implemented");
+            break;
+        case Code::non_ascii:
+            formatter.append("Non-ASCII byte at offset ").append(first);
+            break;
+        case Code::invalid_utf8:
+            formatter.append("Invalid UTF-8 at offset ").append(first);
+            break;
+        case Code::invalid_integer:
+        case Code::invalid_float:
+            formatter.append(_code == Code::invalid_integer ? "Invalid integer \"" : "Invalid float \"").append(detail());
+            formatter.append(_detail_size > detail_capacity ? "...\" at offset " : "\" at offset ").append(first);
+            break;
+        case Code::too_many_integers:
+        case Code::too_many_floats:
+            formatter.append("More than ").append(second).append(_code == Code::too_many_integers ? " integers" : " floats");
+            formatter.append(", stopped at offset ").append(first);
+            break;
+        case Code::serialized_truncated:
+            formatter.append("Serialized data truncated, ").append(second).append(" bytes needed at offset ").append(first);
+            formatter.append(" but ").append(third).append(" remain");
+            break;
+        case Code::serialized_mismatch:
+            formatter.append("Serialized data does not match, expected 0x").append(first, 16).append(" but found 0x").append(second, 16);
+            break;
+        case Code::serialized_misaligned:
+            formatter.append("Serialized array at offset ").append(first).append(" is not aligned to ").append(second).append(" bytes");
+            break;
+        case Code::serialized_too_large:
+            formatter.append("Serialized array of ").append(second).append(" elements at offset ").append(first);
+            formatter.append(" exceeds the capacity of ").append(third);
+            break;
+        case Code::ply_invalid_header:
+            formatter.append("Invalid PLY header line \"").append(detail());
+            formatter.append(_detail_size > detail_capacity ? "...\" at offset " : "\" at offset ").append(first);
+            break;
+        case Code::ply_unsupported:
+            formatter.append("Unsupported PLY feature \"").append(detail()).append("\" at offset ").append(first);
+            break;
+        case Code::ply_value_count:
+            formatter.append("PLY element lines should hold ").append(second).append(" values, mismatch by offset ").append(first);
+            break;
+        case Code::ply_truncated:
+            formatter.append("PLY body truncated, ").append(second).append(" bytes needed at offset ").append(first);
+            formatter.append(" but ").append(third).append(" remain");
+            break;
+        case Code::ply_invalid_index:
+            formatter.append("PLY face ").append(first).append(" has index ").append(second);
+            formatter.append(" but there are ").append(third).append(" vertices");
+            break;
+        default:
+            break;
+        }
+
+        if (_errno != 0) {
+            formatter.append(": ").append(std::strerror(_errno));
+        }
+        return formatter.view();
+    }
+
 } // namespace Utily
@@ -2,11 +2,25 @@
 #pragma once
 
 #include "Utily/TupleAlgo.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <memory>
 #include <ranges>
 #include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h> // SSE2
+#endif
 
 namespace Utily {
 
@@ -14,48 +28,136 @@ namespace Utily {
     {
         using Owner = std::unique_ptr<std::byte[]>;
 
+    public:
+        constexpr static size_t cache_line_size = 64;
+        constexpr static size_t page_size = 4096;
+
+        /*
+            Wrap an array's type to change where it is placed, e.g. Aligned<float, 64> starts on its own cache line.
+            With PadTail the array's storage is rounded up to a multiple of Alignment (zero filled) so full-width
+            vector loads over the last elements stay inside the allocation.
+        */
+        template <typename T, size_t Alignment = alignof(T), bool PadTail = false>
+            requires(std::has_single_bit(Alignment) && Alignment >= alignof(T))
+        struct Aligned {
+            using value_type = T;
+            constexpr static size_t alignment = Alignment;
+            constexpr static bool pad_tail = PadTail;
+        };
+
+        template <typename T, size_t Alignment>
+        using Padded = Aligned<T, Alignment, true>;
+
+    private:
+        template <typename T>
+        struct ArrayTraits {
+            using value_type = T;
+            constexpr static size_t alignment = alignof(T);
+            constexpr static bool pad_tail = false;
+        };
+        template <typename T, size_t Alignment, bool PadTail>
+        struct ArrayTraits<Aligned<T, Alignment, PadTail>> {
+            using value_type = T;
+            constexpr static size_t alignment = Alignment;
+            constexpr static bool pad_tail = PadTail;
+        };
+
+        template <typename T>
+        using ValueOf = typename ArrayTraits<T>::value_type;
+
+        constexpr static auto align_up(size_t offset, size_t alignment) noexcept -> size_t {
+            return (offset + alignment - 1) & ~(alignment - 1);
+        }
+
+        template <typename... Types>
+        struct ArraysLayout {
+            constexpr static auto alignments = std::to_array<size_t>({ ArrayTraits<Types>::alignment... });
+            constexpr static auto type_sizes = std::to_array<size_t>({ sizeof(ValueOf<Types>)... });
+            constexpr static auto pad_tails = std::to_array<bool>({ ArrayTraits<Types>::pad_tail... });
+            constexpr static size_t max_alignment = std::ranges::max(alignments);
+
+            std::array<size_t, sizeof...(Types)> offsets;
+            std::array<size_t, sizeof...(Types)> ends;
+            size_t size;
+
+            // Offsets are relative to a base aligned to max_alignment, so every array only needs rounding up once.
+            constexpr explicit ArraysLayout(const std::array<size_t, sizeof...(Types)>& array_sizes) noexcept
+                : offsets()
+                , ends()
+                , size(0) {
+                for (size_t i = 0; i < sizeof...(Types); ++i) {
+                    offsets[i] = align_up(size, alignments[i]);
+                    ends[i] = offsets[i] + (type_sizes[i] * array_sizes[i]);
+                    size = pad_tails[i] ? align_up(ends[i], alignments[i]) : ends[i];
+                }
+            }
+
+            [[nodiscard]] constexpr auto alloc_size() const noexcept -> size_t {
+                return size + max_alignment - 1;
+            }
+
+            [[nodiscard]] static auto aligned_base(std::byte* data) noexcept -> std::byte* {
+                const auto address = reinterpret_cast<std::uintptr_t>(data);
+                return data + (align_up(address, max_alignment) - address);
+            }
+        };
+
     public:
         template <typename T>
         static auto is_aligned(auto* ptr) {
             return reinterpret_cast<std::uintptr_t>(ptr) % alignof(T) == 0;
         }
+        static auto is_aligned(auto* ptr, size_t alignment) {
+            return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+        }
 
         template <typename... Types, std::integral... Size>
             requires(sizeof...(Size) == sizeof...(Types))
         static auto alloc_uninit(Size... array_size) {
-            constexpr static size_t padding_for_alignment = (alignof(Types) + ...);
+            using Layout = ArraysLayout<Types...>;
 
-            const auto size = padding_for_alignment + ((sizeof(Types) * static_cast<size_t>(array_size)) + ...);
-            Owner data = std::make_unique_for_overwrite<std::byte[]>(size);
+            const auto array_sizes = std::to_array({ (static_cast<size_t>(array_size))... });
+            const auto layout = Layout(array_sizes);
 
-            const auto array_sizes = std::to_array({ (static_cast<std::ptrdiff_t>(array_size))... });
-
-            auto size_iter = array_sizes.begin();
-            std::byte* data_ptr = data.get();
+            Owner data = std::make_unique_for_overwrite<std::byte[]>(layout.alloc_size());
+            std::byte* base = Layout::aligned_base(data.get());
 
+            size_t index = 0;
             auto set_up_span = [&]<typename T>(std::span<T>& span) {
-                while (!is_aligned<T>(data_ptr)) {
-                    ++data_ptr;
+                assert(is_aligned<T>(base + layout.offsets[index]));
+                span = std::span<T> { reinterpret_cast<T*>(base + layout.offsets[index]), array_sizes[index] };
+                if (Layout::pad_tails[index]) {
+                    std::memset(base + layout.ends[index], 0, align_up(layout.ends[index], Layout::alignments[index]) - layout.ends[index]);
                 }
-                T* begin = reinterpret_cast<T*>(data_ptr);
-                T* end = std::next(begin, *size_iter);
-                span = std::span<T> { begin, end };
-                data_ptr = reinterpret_cast<std::byte*>(end);
-                ++size_iter;
+                ++index;
             };
-            using Spans = std::tuple<std::span<Types>...>;
+            using Spans = std::tuple<std::span<ValueOf<Types>>...>;
             Spans spans;
             Utily::TupleAlgo::for_each(spans, set_up_span);
 
-            if (data_ptr >= data_ptr + size) {
-                throw std::runtime_error("Overflowed buffer");
-            }
-
             return std::tuple_cat(std::tuple<Owner>(std::move(data)), spans);
         }
 
+        /*
+            Every array starts on an Alignment boundary, e.g. cache_line_size to avoid false sharing between arrays.
+        */
+        template <size_t Alignment, typename... Types, std::integral... Size>
+            requires(sizeof...(Size) == sizeof...(Types))
+        static auto alloc_uninit_aligned(Size... array_size) {
+            return alloc_uninit<Aligned<ValueOf<Types>, std::max(Alignment, alignof(ValueOf<Types>))>...>(array_size...);
+        }
+
+        /*
+            Every array starts on an Alignment boundary and is padded out to a multiple of Alignment bytes.
+        */
+        template <size_t Alignment, typename... Types, std::integral... Size>
+            requires(sizeof...(Size) == sizeof...(Types))
+        static auto alloc_uninit_padded(Size... array_size) {
+            return alloc_uninit<Padded<ValueOf<Types>, std::max(Alignment, alignof(ValueOf<Types>))>...>(array_size...);
+        }
+
         template <typename... Types, std::integral... Size>
-            requires(std::is_default_constructible_v<Types> && ...)
+            requires(std::is_default_constructible_v<ValueOf<Types>> && ...)
             && (sizeof...(Size) == sizeof...(Types))
         static auto alloc_dafault(Size... array_size) {
             auto owner_and_spans = alloc_uninit<Types...>(array_size...);
@@ -120,5 +222,321 @@ namespace Utily {
         auto static alloc_copy(Range&&... range) {
             return alloc_copy<std::ranges::range_value_t<Range>...>(std::forward<Range>(range)...);
         }
+
+        struct BulkCopy {
+            // Stream the stores past the cache, the copied arrays won't evict the working set.
+            bool non_temporal = true;
+            // Upper limit, each thread is given at least min_bytes_per_thread.
+            size_t max_threads = 1;
+            size_t min_bytes_per_thread = size_t { 4 } << 20;
+        };
+
+    private:
+        struct ByteCopy {
+            std::byte* dest;
+            const std::byte* src;
+            size_t size;
+        };
+
+        // Non-temporal stores where SSE2 has them, a plain memcpy elsewhere.
+        static void stream_copy(std::byte* dest, const std::byte* src, size_t size) noexcept {
+#if defined(__SSE2__) || defined(_M_X64)
+            constexpr static size_t bytes_per_vec = 16;
+
+            const size_t head = std::min(size, align_up(reinterpret_cast<std::uintptr_t>(dest), bytes_per_vec) - reinterpret_cast<std::uintptr_t>(dest));
+            std::memcpy(dest, src, head);
+            dest += head;
+            src += head;
+            size -= head;
+
+            const size_t max_i_clamped = size - (size % (bytes_per_vec * 4));
+            for (size_t i = 0; i < max_i_clamped; i += bytes_per_vec * 4) {
+                const __m128i c0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + (bytes_per_vec * 0)));
+                const __m128i c1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + (bytes_per_vec * 1)));
+                const __m128i c2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + (bytes_per_vec * 2)));
+                const __m128i c3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + (bytes_per_vec * 3)));
+                _mm_stream_si128(reinterpret_cast<__m128i*>(dest + i + (bytes_per_vec * 0)), c0);
+                _mm_stream_si128(reinterpret_cast<__m128i*>(dest + i + (bytes_per_vec * 1)), c1);
+                _mm_stream_si128(reinterpret_cast<__m128i*>(dest + i + (bytes_per_vec * 2)), c2);
+                _mm_stream_si128(reinterpret_cast<__m128i*>(dest + i + (bytes_per_vec * 3)), c3);
+            }
+            std::memcpy(dest + max_i_clamped, src + max_i_clamped, size - max_i_clamped);
+#else
+            std::memcpy(dest, src, size);
+#endif
+        }
+
+        /*
+            Copies the bytes [begin, end) of the jobs laid end to end. A bound inside a job is moved up to
+            the next cache line of its destination, so neighbouring threads never write the same line.
+        */
+        static void copy_job_bytes(std::span<const ByteCopy> jobs, size_t begin, size_t end, bool non_temporal) noexcept {
+            size_t job_begin = 0;
+            for (const ByteCopy& job : jobs) {
+                const size_t job_end = job_begin + job.size;
+                const auto dest = reinterpret_cast<std::uintptr_t>(job.dest);
+                const auto snap = [&](const size_t bound) {
+                    if (bound <= job_begin || bound >= job_end) {
+                        return std::clamp(bound, job_begin, job_end);
+                    }
+                    return job_begin + std::min(job.size, align_up(dest + (bound - job_begin), cache_line_size) - dest);
+                };
+                const size_t lo = snap(begin);
+                const size_t hi = snap(end);
+                if (lo < hi) {
+                    if (non_temporal) {
+                        stream_copy(job.dest + (lo - job_begin), job.src + (lo - job_begin), hi - lo);
+                    } else {
+                        std::memcpy(job.dest + (lo - job_begin), job.src + (lo - job_begin), hi - lo);
+                    }
+                }
+                job_begin = job_end;
+            }
+#if defined(__SSE2__) || defined(_M_X64)
+            if (non_temporal) {
+                _mm_sfence();
+            }
+#endif
+        }
+
+        static void run_byte_copies(std::span<const ByteCopy> jobs, const BulkCopy& options) {
+            size_t total = 0;
+            for (const ByteCopy& job : jobs) {
+                total += job.size;
+            }
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+            const size_t num_threads = 1;
+#else
+            const size_t num_threads = std::clamp(total / std::max(options.min_bytes_per_thread, size_t { 1 }), size_t { 1 }, std::max(options.max_threads, size_t { 1 }));
+#endif
+            const size_t chunk = (total + num_threads - 1) / num_threads;
+
+            std::vector<std::jthread> workers;
+            workers.reserve(num_threads - 1);
+            for (size_t t = 1; t < num_threads; ++t) {
+                workers.emplace_back(copy_job_bytes, jobs, std::min(total, t * chunk), std::min(total, (t + 1) * chunk), options.non_temporal);
+            }
+            copy_job_bytes(jobs, 0, std::min(total, chunk), options.non_temporal);
+        }
+
+    public:
+        /*
+            Same as alloc_copy but trivially copyable contiguous ranges are copied as raw bytes, with
+            non-temporal stores and split across threads as requested. Other ranges fall back to alloc_copy's path.
+        */
+        template <typename... Types, std::ranges::range... Range>
+            requires(sizeof...(Types) == sizeof...(Range))
+        auto static alloc_copy(const BulkCopy& options, Range&&... range) {
+            auto owner_and_spans = alloc_uninit<Types...>(get_range_size(std::forward<Range>(range))...);
+
+            std::vector<ByteCopy> jobs;
+            jobs.reserve(sizeof...(Range));
+
+            auto copy_or_defer = [&]<size_t... I>(std::index_sequence<I...>) {
+                auto one = [&]<typename T, typename R>(std::span<T> dest, R&& src) {
+                    using Src = std::remove_cvref_t<R>;
+                    if constexpr (Utily::Concepts::IsContiguousRange<Src>
+                        && std::same_as<std::remove_cv_t<std::ranges::range_value_t<Src>>, T>
+                        && std::is_trivially_copyable_v<T>) {
+                        jobs.push_back(ByteCopy {
+                            .dest = reinterpret_cast<std::byte*>(dest.data()),
+                            .src = reinterpret_cast<const std::byte*>(std::ranges::data(src)),
+                            .size = dest.size_bytes() });
+                    } else {
+                        std::ranges::uninitialized_copy(src, dest);
+                    }
+                };
+                (one(std::get<I + 1>(owner_and_spans), std::forward<Range>(range)), ...);
+            };
+            copy_or_defer(std::index_sequence_for<Range...> {});
+
+            run_byte_copies(jobs, options);
+            return owner_and_spans;
+        }
+        template <std::ranges::range... Range>
+        auto static alloc_copy(const BulkCopy& options, Range&&... range) {
+            return alloc_copy<std::ranges::range_value_t<Range>...>(options, std::forward<Range>(range)...);
+        }
+
+        /*
+            A growable version of alloc_uninit's block, for when the final array sizes aren't known up front.
+            All arrays live in one allocation; when any array runs out of room every array's capacity is grown
+            geometrically and each is relocated with a single memcpy. freeze() hands back the usual owner + spans.
+        */
+        template <typename... Types>
+            requires(sizeof...(Types) > 0 && (std::is_trivially_copyable_v<ValueOf<Types>> && ...))
+        class Block
+        {
+            using Layout = ArraysLayout<Types...>;
+            using Sizes = std::array<size_t, sizeof...(Types)>;
+
+            template <size_t I>
+            using Element = std::tuple_element_t<I, std::tuple<ValueOf<Types>...>>;
+
+            constexpr static size_t first_element_capacity = 8;
+            constexpr static size_t growth_factor = 2;
+
+            Owner _data;
+            std::byte* _base = nullptr;
+            Sizes _sizes = {};
+            Sizes _capacities = {};
+            Sizes _offsets = {};
+
+            void relocate(const Sizes& capacities) {
+                const auto layout = Layout(capacities);
+                Owner data = std::make_unique_for_overwrite<std::byte[]>(layout.alloc_size());
+                std::byte* base = Layout::aligned_base(data.get());
+
+                for (size_t i = 0; i < sizeof...(Types); ++i) {
+                    if (_sizes[i] != 0) {
+                        std::memcpy(base + layout.offsets[i], _base + _offsets[i], _sizes[i] * Layout::type_sizes[i]);
+                    }
+                }
+                _data = std::move(data);
+                _base = base;
+                _capacities = capacities;
+                _offsets = layout.offsets;
+            }
+
+            // As alloc_uninit does, zeroes the bytes from the last element of each padded array to its aligned end.
+            void zero_padded_tails() noexcept {
+                for (size_t i = 0; i < sizeof...(Types); ++i) {
+                    if (Layout::pad_tails[i]) {
+                        const size_t end = _offsets[i] + _sizes[i] * Layout::type_sizes[i];
+                        std::memset(_base + end, 0, align_up(end, Layout::alignments[i]) - end);
+                    }
+                }
+            }
+
+            void ensure_capacity(const Sizes& required) {
+                if (std::ranges::equal(required, _capacities, std::less_equal {})) [[likely]] {
+                    return;
+                }
+                Sizes capacities;
+                for (size_t i = 0; i < sizeof...(Types); ++i) {
+                    capacities[i] = std::max({ required[i], _capacities[i] * growth_factor, first_element_capacity });
+                }
+                relocate(capacities);
+            }
+
+            template <size_t I>
+            [[nodiscard]] auto data() const noexcept -> Element<I>* {
+                return reinterpret_cast<Element<I>*>(_base + _offsets[I]);
+            }
+
+        public:
+            Block() = default;
+
+            template <std::integral... Size>
+                requires(sizeof...(Size) == sizeof...(Types))
+            explicit Block(Size... capacities) {
+                reserve(capacities...);
+            }
+
+            // The moved-from block is left empty, as freeze() leaves it, so it never points into the other's buffer.
+            Block(const Block&) = delete;
+            Block(Block&& other) noexcept
+                : _data(std::move(other._data))
+                , _base(std::exchange(other._base, nullptr))
+                , _sizes(std::exchange(other._sizes, {}))
+                , _capacities(std::exchange(other._capacities, {}))
+                , _offsets(std::exchange(other._offsets, {})) { }
+            auto operator=(const Block&) -> Block& = delete;
+            auto operator=(Block&& other) noexcept -> Block& {
+                if (this != &other) {
+                    _data = std::move(other._data);
+                    _base = std::exchange(other._base, nullptr);
+                    _sizes = std::exchange(other._sizes, {});
+                    _capacities = std::exchange(other._capacities, {});
+                    _offsets = std::exchange(other._offsets, {});
+                }
+                return *this;
+            }
+
+            template <size_t I>
+            [[nodiscard]] auto size() const noexcept -> size_t { return _sizes[I]; }
+            template <size_t I>
+            [[nodiscard]] auto capacity() const noexcept -> size_t { return _capacities[I]; }
+
+            template <size_t I>
+            [[nodiscard]] auto span() noexcept -> std::span<Element<I>> {
+                return { data<I>(), _sizes[I] };
+            }
+            template <size_t I>
+            [[nodiscard]] auto span() const noexcept -> std::span<const Element<I>> {
+                return { data<I>(), _sizes[I] };
+            }
+
+            template <std::integral... Size>
+                requires(sizeof...(Size) == sizeof...(Types))
+            void reserve(Size... capacities) {
+                const auto required = std::to_array({ (static_cast<size_t>(capacities))... });
+                if (!std::ranges::equal(required, _capacities, std::less_equal {})) {
+                    Sizes exact;
+                    std::ranges::transform(required, _capacities, exact.begin(), [](size_t a, size_t b) { return std::max(a, b); });
+                    relocate(exact);
+                }
+            }
+
+            // New elements are value initialised.
+            template <std::integral... Size>
+                requires(sizeof...(Size) == sizeof...(Types))
+            void resize(Size... sizes) {
+                const auto required = std::to_array({ (static_cast<size_t>(sizes))... });
+                ensure_capacity(required);
+                auto value_init = [&]<size_t... I>(std::index_sequence<I...>) {
+                    ((required[I] > _sizes[I] ? (void)std::uninitialized_value_construct_n(data<I>() + _sizes[I], required[I] - _sizes[I]) : (void)0), ...);
+                };
+                value_init(std::index_sequence_for<Types...> {});
+                _sizes = required;
+            }
+
+            template <size_t I, typename... Args>
+            auto emplace_back(Args&&... args) -> Element<I>& {
+                if (_sizes[I] == _capacities[I]) [[unlikely]] {
+                    Sizes required = _sizes;
+                    ++required[I];
+                    ensure_capacity(required);
+                }
+                return *std::construct_at(data<I>() + _sizes[I]++, std::forward<Args>(args)...);
+            }
+
+            template <size_t I>
+            void push_back(const Element<I>& element) {
+                emplace_back<I>(element);
+            }
+
+            template <size_t I>
+            void append(std::span<const Element<I>> elements) {
+                Sizes required = _sizes;
+                required[I] += elements.size();
+                ensure_capacity(required);
+                if (!elements.empty()) {
+                    std::memcpy(data<I>() + _sizes[I], elements.data(), elements.size_bytes());
+                }
+                _sizes[I] += elements.size();
+            }
+
+            void clear() noexcept {
+                _sizes = {};
+            }
+
+            // Releases the block as the same owner + spans tuple alloc_uninit returns, the block is left empty.
+            [[nodiscard]] auto freeze() -> std::tuple<Owner, std::span<ValueOf<Types>>...> {
+                if (_data == nullptr) {
+                    relocate(_capacities);
+                }
+                zero_padded_tails();
+                auto spans = [&]<size_t... I>(std::index_sequence<I...>) {
+                    return std::tuple<std::span<ValueOf<Types>>...> { span<I>()... };
+                }(std::index_sequence_for<Types...> {});
+
+                _base = nullptr;
+                _sizes = {};
+                _capacities = {};
+                _offsets = {};
+                return std::tuple_cat(std::tuple<Owner>(std::move(_data)), spans);
+            }
+        };
     };
 }
\ No newline at end of file
@@ -0,0 +1,319 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Utily/Simd128.hpp"
+
+namespace Utily {
+
+    /*
+     * Compiles a set of patterns once, then reports every (pattern_id, offset) match in one pass over the text.
+     * Small sets use a Teddy style fingerprint filter (PSHUFB nibble tables over the first 1-3 bytes of each
+     * pattern, 8 buckets) and memcmp verification. Large sets, where the nibble tables saturate, use a dense
+     * Aho-Corasick automaton over byte classes at one table lookup per byte.
+     * Matches may overlap. Empty patterns never match.
+     */
+    class MultiSearch
+    {
+    public:
+        enum class Engine : uint8_t {
+            automatic,
+            teddy,
+            aho_corasick
+        };
+
+        struct Match {
+            size_t pattern_id;
+            size_t offset;
+
+            constexpr auto operator==(const Match&) const noexcept -> bool = default;
+        };
+
+        // Past this the fingerprints of 8 buckets overlap enough that Aho-Corasick is faster.
+        constexpr static size_t max_teddy_patterns = 24;
+
+        explicit MultiSearch(std::span<const std::string_view> patterns, Engine engine = Engine::automatic) {
+            _offsets.reserve(patterns.size() + 1);
+            _offsets.push_back(0);
+            for (const auto pattern : patterns) {
+                _storage.append(pattern);
+                _offsets.push_back(_storage.size());
+            }
+            if (engine == Engine::automatic) {
+                engine = pick_engine();
+            }
+            _engine = engine;
+            if (_engine == Engine::teddy) {
+                build_teddy();
+            } else {
+                build_aho_corasick();
+            }
+        }
+
+        MultiSearch(std::initializer_list<std::string_view> patterns, Engine engine = Engine::automatic)
+            : MultiSearch(std::span { patterns.begin(), patterns.size() }, engine) { }
+
+        [[nodiscard]] auto engine() const noexcept -> Engine {
+            return _engine;
+        }
+        [[nodiscard]] auto pattern_count() const noexcept -> size_t {
+            return _offsets.size() - 1;
+        }
+        [[nodiscard]] auto pattern(size_t id) const noexcept -> std::string_view {
+            return std::string_view { _storage }.substr(_offsets[id], _offsets[id + 1] - _offsets[id]);
+        }
+
+        /*
+         * Calls on_match(Match) for every match. Each pattern's matches arrive in increasing offset order,
+         * the interleaving between patterns depends on the engine.
+         */
+        template <typename OnMatch>
+            requires std::invocable<OnMatch&, Match>
+        void for_each_match(std::string_view text, OnMatch&& on_match) const {
+            if (_engine == Engine::teddy) {
+                switch (_fingerprint_size) {
+                case 1: scan_teddy<1>(text, on_match); break;
+                case 2: scan_teddy<2>(text, on_match); break;
+                case 3: scan_teddy<3>(text, on_match); break;
+                default: break;
+                }
+            } else {
+                scan_aho_corasick(text, on_match);
+            }
+        }
+
+        // All matches, ordered by offset then pattern_id.
+        [[nodiscard]] auto find_all(std::string_view text) const -> std::vector<Match> {
+            std::vector<Match> matches;
+            for_each_match(text, [&](Match match) { matches.push_back(match); });
+            std::ranges::sort(matches, [](const Match& lhs, const Match& rhs) {
+                return lhs.offset != rhs.offset ? lhs.offset < rhs.offset : lhs.pattern_id < rhs.pattern_id;
+            });
+            return matches;
+        }
+
+    private:
+        constexpr static size_t bucket_count = 8;
+        constexpr static size_t max_fingerprint_size = 3;
+        constexpr static uint32_t no_state = std::numeric_limits<uint32_t>::max();
+        constexpr static uint32_t has_output = uint32_t { 1 } << 31;
+
+        std::string _storage;
+        std::vector<size_t> _offsets;
+        Engine _engine;
+
+        // Teddy
+        __m128i _low_nibbles[max_fingerprint_size] {};
+        __m128i _high_nibbles[max_fingerprint_size] {};
+        std::array<std::vector<uint32_t>, bucket_count> _buckets;
+        size_t _fingerprint_size = 0;
+
+        // Aho-Corasick
+        std::array<uint16_t, 256> _byte_class {};
+        size_t _class_count = 0;
+        std::vector<uint32_t> _transitions;
+        std::vector<uint32_t> _output_offsets;
+        std::vector<uint32_t> _output_ids;
+
+        [[nodiscard]] auto pick_engine() const noexcept -> Engine {
+            size_t min_size = std::numeric_limits<size_t>::max();
+            for (size_t id = 0; id < pattern_count(); ++id) {
+                if (!pattern(id).empty()) {
+                    min_size = std::min(min_size, pattern(id).size());
+                }
+            }
+            // A single byte fingerprint lets through too many candidates once there are a few patterns.
+            if (pattern_count() <= max_teddy_patterns && min_size != std::numeric_limits<size_t>::max()
+                && (min_size >= 2 || pattern_count() <= bucket_count)) {
+                return Engine::teddy;
+            }
+            return Engine::aho_corasick;
+        }
+
+        void build_teddy() {
+            size_t min_size = max_fingerprint_size;
+            for (size_t id = 0; id < pattern_count(); ++id) {
+                if (!pattern(id).empty()) {
+                    min_size = std::min(min_size, pattern(id).size());
+                }
+            }
+            _fingerprint_size = min_size;
+
+            alignas(16) std::array<std::array<uint8_t, 16>, max_fingerprint_size> low {};
+            alignas(16) std::array<std::array<uint8_t, 16>, max_fingerprint_size> high {};
+            size_t bucket = 0;
+            for (size_t id = 0; id < pattern_count(); ++id) {
+                const auto pat = pattern(id);
+                if (pat.empty()) {
+                    continue;
+                }
+                const auto bit = static_cast<uint8_t>(1u << bucket);
+                for (size_t k = 0; k < _fingerprint_size; ++k) {
+                    const auto c = static_cast<uint8_t>(pat[k]);
+                    low[k][c & 0xF] |= bit;
+                    high[k][c >> 4] |= bit;
+                }
+                _buckets[bucket].push_back(static_cast<uint32_t>(id));
+                bucket = (bucket + 1) % bucket_count;
+            }
+            for (size_t k = 0; k < _fingerprint_size; ++k) {
+                _low_nibbles[k] = _mm_load_si128(reinterpret_cast<const __m128i*>(low[k].data()));
+                _high_nibbles[k] = _mm_load_si128(reinterpret_cast<const __m128i*>(high[k].data()));
+            }
+        }
+
+        template <typename OnMatch>
+        UTY_ALWAYS_INLINE void verify_bucket(std::string_view text, size_t pos, size_t bucket, OnMatch& on_match) const {
+            for (const uint32_t id : _buckets[bucket]) {
+                const auto pat = pattern(id);
+                if (pat.size() <= text.size() - pos && std::memcmp(text.data() + pos, pat.data(), pat.size()) == 0) {
+                    on_match(Match { id, pos });
+                }
+            }
+        }
+
+        template <size_t FingerprintSize, typename OnMatch>
+        void scan_teddy(std::string_view text, OnMatch& on_match) const {
+            constexpr static size_t chars_per_vec = 128 / 8;
+
+            const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+            const auto bucket_bits = [&](size_t k, const __m128i c) {
+                const __m128i lo = _mm_shuffle_epi8(_low_nibbles[k], _mm_and_si128(c, nibble_mask));
+                const __m128i hi = _mm_shuffle_epi8(_high_nibbles[k], _mm_and_si128(_mm_srli_epi16(c, 4), nibble_mask));
+                return _mm_and_si128(lo, hi);
+            };
+
+            const char* src = text.data();
+            size_t i = 0;
+            // Lane j of the k-th load holds byte i + j + k, so the AND lines up all fingerprint bytes of a start at i + j.
+            for (; i + chars_per_vec + FingerprintSize - 1 <= text.size(); i += chars_per_vec) {
+                __m128i candidates = bucket_bits(0, _mm_lddqu_si128(reinterpret_cast<const __m128i*>(src + i)));
+                if constexpr (FingerprintSize > 1) {
+                    candidates = _mm_and_si128(candidates, bucket_bits(1, _mm_lddqu_si128(reinterpret_cast<const __m128i*>(src + i + 1))));
+                }
+                if constexpr (FingerprintSize > 2) {
+                    candidates = _mm_and_si128(candidates, bucket_bits(2, _mm_lddqu_si128(reinterpret_cast<const __m128i*>(src + i + 2))));
+                }
+                auto lanes = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(candidates, _mm_setzero_si128()))) ^ 0xFFFFu;
+                if (lanes == 0) {
+                    continue;
+                }
+                alignas(16) std::array<uint8_t, chars_per_vec> buckets;
+                _mm_store_si128(reinterpret_cast<__m128i*>(buckets.data()), candidates);
+                for (; lanes != 0; lanes &= lanes - 1) {
+                    const auto lane = static_cast<size_t>(std::countr_zero(lanes));
+                    for (uint32_t bits = buckets[lane]; bits != 0; bits &= bits - 1) {
+                        verify_bucket(text, i + lane, static_cast<size_t>(std::countr_zero(bits)), on_match);
+                    }
+                }
+            }
+            for (; i < text.size(); ++i) {
+                for (size_t bucket = 0; bucket < bucket_count; ++bucket) {
+                    verify_bucket(text, i, bucket, on_match);
+                }
+            }
+        }
+
+        void build_aho_corasick() {
+            // Bytes that appear in no pattern share class 0, which keeps the table narrow.
+            for (const char c : _storage) {
+                _byte_class[static_cast<uint8_t>(c)] = 1;
+            }
+            _class_count = 1;
+            for (auto& byte_class : _byte_class) {
+                byte_class = byte_class != 0 ? static_cast<uint16_t>(_class_count++) : uint16_t { 0 };
+            }
+
+            // Trie.
+            _transitions.assign(_class_count, no_state);
+            std::vector<std::vector<uint32_t>> outputs(1);
+            for (size_t id = 0; id < pattern_count(); ++id) {
+                const auto pat = pattern(id);
+                if (pat.empty()) {
+                    continue;
+                }
+                uint32_t state = 0;
+                for (const char c : pat) {
+                    uint32_t& next = _transitions[state * _class_count + _byte_class[static_cast<uint8_t>(c)]];
+                    if (next == no_state) {
+                        next = static_cast<uint32_t>(outputs.size());
+                        outputs.emplace_back();
+                        _transitions.resize(_transitions.size() + _class_count, no_state);
+                    }
+                    state = _transitions[state * _class_count + _byte_class[static_cast<uint8_t>(c)]];
+                }
+                outputs[state].push_back(static_cast<uint32_t>(id));
+            }
+
+            // Breadth first, fill in every missing edge from the failure state so scanning is one lookup per byte.
+            std::vector<uint32_t> failure(outputs.size(), 0);
+            std::vector<uint32_t> queue;
+            queue.reserve(outputs.size());
+            for (size_t c = 0; c < _class_count; ++c) {
+                uint32_t& next = _transitions[c];
+                if (next == no_state) {
+                    next = 0;
+                } else {
+                    queue.push_back(next);
+                }
+            }
+            for (size_t head = 0; head < queue.size(); ++head) {
+                const uint32_t state = queue[head];
+                const auto& fallback = outputs[failure[state]];
+                outputs[state].insert(outputs[state].end(), fallback.begin(), fallback.end());
+                for (size_t c = 0; c < _class_count; ++c) {
+                    uint32_t& next = _transitions[state * _class_count + c];
+                    const uint32_t failure_next = _transitions[failure[state] * _class_count + c];
+                    if (next == no_state) {
+                        next = failure_next;
+                    } else {
+                        failure[next] = failure_next;
+                        queue.push_back(next);
+                    }
+                }
+            }
+
+            _output_offsets.reserve(outputs.size() + 1);
+            _output_offsets.push_back(0);
+            for (const auto& ids : outputs) {
+                _output_ids.insert(_output_ids.end(), ids.begin(), ids.end());
+                _output_offsets.push_back(static_cast<uint32_t>(_output_ids.size()));
+            }
+
+            // Store the next state's row rather than its index, flagged when it has output to report.
+            for (auto& next : _transitions) {
+                next = static_cast<uint32_t>(next * _class_count) | (outputs[next].empty() ? 0 : has_output);
+            }
+        }
+
+        template <typename OnMatch>
+        void scan_aho_corasick(std::string_view text, OnMatch& on_match) const {
+            const auto* src = reinterpret_cast<const uint8_t*>(text.data());
+            const uint32_t* transitions = _transitions.data();
+            const uint16_t* byte_class = _byte_class.data();
+            uint32_t row = 0;
+            for (size_t i = 0; i < text.size(); ++i) {
+                const uint32_t next = transitions[row + byte_class[src[i]]];
+                row = next & ~has_output;
+                if (next & has_output) [[unlikely]] {
+                    const size_t state = row / _class_count;
+                    for (uint32_t o = _output_offsets[state]; o < _output_offsets[state + 1]; ++o) {
+                        const uint32_t id = _output_ids[o];
+                        on_match(Match { id, i + 1 - (_offsets[id + 1] - _offsets[id]) });
+                    }
+                }
+            }
+        }
+    };
+}
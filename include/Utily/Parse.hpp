@@ -0,0 +1,462 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <string_view>
+#include <system_error>
+
+#include "Utily/Error.hpp"
+#include "Utily/Result.hpp"
+#include "Utily/TypeErasedVector.hpp"
+#if defined(__SSE2__) || defined(_M_X64)
+#include "Utily/Simd128.hpp"
+#endif
+#if defined(__AVX512BW__)
+#include <immintrin.h>
+#endif
+
+namespace Utily::Parse::Details {
+    // Bit i is set when p[i] is `value`. Reads 64 bytes.
+    UTY_ALWAYS_INLINE auto equal_mask(const char* p, const char value) noexcept -> uint64_t {
+#if defined(__AVX512BW__)
+        return _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(p), _mm512_set1_epi8(value));
+#elif defined(__SSE2__) || defined(_M_X64)
+        uint64_t mask = 0;
+        for (size_t k = 0; k < 4; ++k) {
+            const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + k * 16));
+            mask |= uint64_t { std::bit_cast<uint16_t>(static_cast<int16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(c, _mm_set1_epi8(value))))) } << (k * 16);
+        }
+        return mask;
+#else
+        uint64_t mask = 0;
+        for (size_t i = 0; i < 64; ++i) {
+            mask |= uint64_t { p[i] == value } << i;
+        }
+        return mask;
+#endif
+    }
+
+    // Bit i is set when p[i] separates tokens, the delimiter or a line break. Reads 64 bytes.
+    UTY_ALWAYS_INLINE auto separator_mask(const char* p, const char delimiter) noexcept -> uint64_t {
+#if defined(__AVX512BW__)
+        const __m512i c = _mm512_loadu_si512(p);
+        return _mm512_cmpeq_epi8_mask(c, _mm512_set1_epi8(delimiter))
+            | _mm512_cmpeq_epi8_mask(c, _mm512_set1_epi8('\n'))
+            | _mm512_cmpeq_epi8_mask(c, _mm512_set1_epi8('\r'));
+#elif defined(__SSE2__) || defined(_M_X64)
+        uint64_t mask = 0;
+        for (size_t k = 0; k < 4; ++k) {
+            const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + k * 16));
+            const __m128i sep = _mm_or_si128(
+                _mm_cmpeq_epi8(c, _mm_set1_epi8(delimiter)),
+                _mm_or_si128(_mm_cmpeq_epi8(c, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(c, _mm_set1_epi8('\r'))));
+            mask |= uint64_t { std::bit_cast<uint16_t>(static_cast<int16_t>(_mm_movemask_epi8(sep))) } << (k * 16);
+        }
+        return mask;
+#else
+        uint64_t mask = 0;
+        for (size_t i = 0; i < 64; ++i) {
+            mask |= uint64_t { p[i] == delimiter || p[i] == '\n' || p[i] == '\r' } << i;
+        }
+        return mask;
+#endif
+    }
+
+    struct ShortNumber {
+        uint64_t mantissa;
+        int fraction_digits;
+        bool negative;
+    };
+
+#if (defined(__SSSE3__) && defined(__SSE4_1__)) || defined(_M_X64)
+    /*
+        [+-]digits[.digits] in the n <= 16 bytes at `first`, the common shape in text formats. The digits are
+        gathered right aligned into one vector by a pshufb that also drops the '.', then combined pairwise by
+        multiply-adds, so nothing branches on the number of digits. Reads 16 bytes.
+    */
+    UTY_ALWAYS_INLINE auto parse_short_number(const char* first, const size_t n, const bool allow_dot, ShortNumber& number) noexcept -> bool {
+        const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+        const __m128i values = _mm_sub_epi8(c, _mm_set1_epi8('0'));
+        const auto digits = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmplt_epi8(_mm_xor_si128(values, _mm_set1_epi8(-128)), _mm_set1_epi8(-128 + 10))));
+        const auto dots = allow_dot ? static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(c, _mm_set1_epi8('.')))) : 0;
+
+        const int sign = (first[0] == '-' || first[0] == '+') ? 1 : 0;
+        const uint32_t token = ((uint32_t { 1 } << n) - 1) & ~((uint32_t { 1 } << sign) - 1);
+        const uint32_t token_dots = dots & token;
+        if (((digits | token_dots) & token) != token || (token_dots & (token_dots - 1)) != 0 || (digits & token) == 0) {
+            return false;
+        }
+        const int has_dot = token_dots != 0;
+        const int integer_digits = (has_dot ? std::countr_zero(token_dots) : static_cast<int>(n)) - sign;
+        const int digit_count = static_cast<int>(n) - sign - has_dot;
+
+        // Lane j takes digit k = j - (16 - digit_count) from byte sign + k, or the one after once past the '.'.
+        const __m128i k = _mm_sub_epi8(_mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _mm_set1_epi8(static_cast<char>(16 - digit_count)));
+        const __m128i past_dot = _mm_and_si128(_mm_cmpgt_epi8(k, _mm_set1_epi8(static_cast<char>(integer_digits - 1))), _mm_set1_epi8(static_cast<char>(has_dot)));
+        const __m128i index = _mm_or_si128(
+            _mm_add_epi8(_mm_add_epi8(k, _mm_set1_epi8(static_cast<char>(sign))), past_dot),
+            _mm_cmplt_epi8(k, _mm_setzero_si128())); // leading lanes are zeroed.
+        const __m128i aligned = _mm_shuffle_epi8(values, index);
+
+        const __m128i pairs = _mm_maddubs_epi16(aligned, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1));
+        const __m128i quads = _mm_madd_epi16(pairs, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+        const __m128i octets = _mm_madd_epi16(_mm_packus_epi32(quads, quads), _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1));
+        number.mantissa = uint64_t { static_cast<uint32_t>(_mm_cvtsi128_si32(octets)) } * 100'000'000
+            + static_cast<uint32_t>(_mm_extract_epi32(octets, 1));
+        number.fraction_digits = digit_count - integer_digits;
+        number.negative = first[0] == '-';
+        return true;
+    }
+#else
+    // As above, one byte at a time, for targets built without SSSE3 and SSE4.1.
+    UTY_ALWAYS_INLINE auto parse_short_number(const char* first, const size_t n, const bool allow_dot, ShortNumber& number) noexcept -> bool {
+        const size_t sign = (n != 0 && (first[0] == '-' || first[0] == '+')) ? 1 : 0;
+        uint64_t mantissa = 0;
+        int digit_count = 0;
+        int fraction_digits = 0;
+        bool has_dot = false;
+        for (size_t i = sign; i < n; ++i) {
+            const auto digit = static_cast<unsigned char>(first[i] - '0');
+            if (digit < 10) {
+                mantissa = mantissa * 10 + digit;
+                ++digit_count;
+                if (has_dot) {
+                    ++fraction_digits;
+                }
+            } else if (first[i] == '.' && allow_dot && !has_dot) {
+                has_dot = true;
+            } else {
+                return false;
+            }
+        }
+        if (digit_count == 0) {
+            return false;
+        }
+        number.mantissa = mantissa;
+        number.fraction_digits = fraction_digits;
+        number.negative = first[0] == '-';
+        return true;
+    }
+#endif
+
+    // [+-]digits. `readable_end` bounds the bytes the SWAR path may load past `last`.
+    template <std::integral T>
+    UTY_ALWAYS_INLINE auto parse_int(const char* first, const char* last, const char* readable_end, T& out) noexcept -> bool {
+        const auto n = static_cast<size_t>(last - first);
+        ShortNumber number;
+        uint64_t magnitude;
+        bool negative;
+        if (n <= 16 && readable_end - first >= 16) {
+            if (!parse_short_number(first, n, false, number)) {
+                return false;
+            }
+            magnitude = number.mantissa;
+            negative = number.negative;
+        } else {
+            negative = *first == '-';
+            const char* p = (*first == '-' || *first == '+') ? first + 1 : first;
+            const auto [end, ec] = std::from_chars(p, last, magnitude);
+            if (p == last || ec != std::errc {} || end != last) {
+                return false;
+            }
+        }
+
+        using Unsigned = std::make_unsigned_t<T>;
+        constexpr auto max = static_cast<uint64_t>(std::numeric_limits<T>::max());
+        if (negative) {
+            if constexpr (std::unsigned_integral<T>) {
+                return false;
+            } else {
+                if (magnitude > max + 1) {
+                    return false;
+                }
+                out = static_cast<T>(static_cast<Unsigned>(0 - magnitude));
+            }
+        } else {
+            if (magnitude > max) {
+                return false;
+            }
+            out = static_cast<T>(magnitude);
+        }
+        return true;
+    }
+
+    template <std::floating_point T>
+    struct FastPath;
+    template <>
+    struct FastPath<float> {
+        constexpr static uint64_t max_mantissa = uint64_t { 1 } << 24;
+        constexpr static int max_exponent = 10;
+    };
+    template <>
+    struct FastPath<double> {
+        constexpr static uint64_t max_mantissa = uint64_t { 1 } << 53;
+        constexpr static int max_exponent = 22;
+    };
+
+    template <std::floating_point T>
+    constexpr static auto powers_of_10 = [] {
+        std::array<T, FastPath<T>::max_exponent + 1> powers;
+        T power = 1;
+        for (auto& p : powers) {
+            p = power;
+            power *= 10;
+        }
+        return powers;
+    }();
+
+    template <std::floating_point T>
+    UTY_ALWAYS_INLINE auto fast_path(const uint64_t mantissa, const int exponent, const bool negative, T& out) noexcept -> bool {
+        if (mantissa > FastPath<T>::max_mantissa || exponent < -FastPath<T>::max_exponent || exponent > FastPath<T>::max_exponent) {
+            return false;
+        }
+        T value = static_cast<T>(mantissa);
+        if (exponent < 0) {
+            value /= powers_of_10<T>[static_cast<size_t>(-exponent)];
+        } else {
+            value *= powers_of_10<T>[static_cast<size_t>(exponent)];
+        }
+        out = negative ? -value : value;
+        return true;
+    }
+
+    /*
+        [+-]digits[.digits][(e|E)[+-]digits]. When the digits form an exact mantissa and the power of 10 is
+        exact too, one multiply or divide is correctly rounded (Clinger's fast path), anything else goes to
+        std::from_chars.
+    */
+    template <std::floating_point T>
+    UTY_ALWAYS_INLINE auto parse_float(const char* first, const char* last, const char* readable_end, T& out) noexcept -> bool {
+        const auto n = static_cast<size_t>(last - first);
+        if (ShortNumber number; n <= 16 && readable_end - first >= 16 && parse_short_number(first, n, true, number)) {
+            if (fast_path(number.mantissa, -number.fraction_digits, number.negative, out)) {
+                return true;
+            }
+        }
+
+        const char* p = first;
+        bool negative = false;
+        if (p != last && (*p == '-' || *p == '+')) {
+            negative = *p == '-';
+            ++p;
+        }
+        const auto is_digit = [](const char c) { return static_cast<unsigned char>(c - '0') < 10; };
+
+        uint64_t mantissa = 0;
+        int significant_digits = 0;
+        int exponent = 0;
+        bool any_digits = false;
+        const auto accumulate = [&](const char c) {
+            any_digits = true;
+            if (mantissa == 0 && c == '0') {
+                return;
+            }
+            mantissa = mantissa * 10 + static_cast<uint64_t>(c - '0');
+            ++significant_digits;
+        };
+        for (; p != last && is_digit(*p); ++p) {
+            accumulate(*p);
+        }
+        if (p != last && *p == '.') {
+            for (++p; p != last && is_digit(*p); ++p) {
+                accumulate(*p);
+                --exponent;
+            }
+        }
+        if (any_digits && p != last && (*p == 'e' || *p == 'E')) {
+            ++p;
+            bool negative_exponent = false;
+            if (p != last && (*p == '-' || *p == '+')) {
+                negative_exponent = *p == '-';
+                ++p;
+            }
+            int explicit_exponent = 0;
+            const char* digits_begin = p;
+            for (; p != last && is_digit(*p) && explicit_exponent < 100'000; ++p) {
+                explicit_exponent = explicit_exponent * 10 + (*p - '0');
+            }
+            if (p == digits_begin) {
+                p = first; // no exponent digits, let from_chars decide.
+            }
+            exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+        }
+
+        if (p == last && any_digits && significant_digits <= 19 && fast_path(mantissa, exponent, negative, out)) {
+            return true;
+        }
+
+        // from_chars takes no leading '+'.
+        const char* from = (first != last && *first == '+') ? first + 1 : first;
+        const auto [end, ec] = std::from_chars(from, last, out);
+        return ec == std::errc {} && end == last;
+    }
+
+    enum class Status : uint8_t {
+        done,
+        full,
+        invalid
+    };
+
+    struct Progress {
+        size_t count;
+        size_t offset; // where parsing stopped, the start of the token that was invalid or had no room.
+        Status status;
+    };
+
+    /*
+        Tokens are found 64 bytes at a time from a separator bitmask. Its token start and end bits pair up
+        in order, so each token costs two countr_zero and one well predicted branch. A token left open at the
+        end of a block is finished by the first end bit of the next. `convert(first, last, readable_end, value)`
+        turns a token into a value.
+    */
+    template <typename T, typename Convert>
+    UTY_ALWAYS_INLINE auto parse_tokens(const std::string_view src, const char delimiter, T* out, const size_t out_size, const Convert& convert) noexcept -> Progress {
+        constexpr static size_t block_size = 64;
+        const char* data = src.data();
+        const char* data_end = data + src.size();
+
+        size_t count = 0;
+        size_t open_token = 0;
+        bool is_open = false;
+        // Whether the byte before the block was a separator, the start of the source counts as one.
+        uint64_t separator_before = 1;
+
+        const auto emit = [&](const size_t token_begin, const size_t token_end) -> Status {
+            if (count == out_size) {
+                return Status::full;
+            }
+            if (!convert(data + token_begin, data + token_end, data_end, out[count])) {
+                return Status::invalid;
+            }
+            ++count;
+            return Status::done;
+        };
+
+        for (size_t base = 0; base < src.size(); base += block_size) {
+            uint64_t separators;
+            if (base + block_size <= src.size()) {
+                separators = separator_mask(data + base, delimiter);
+            } else {
+                std::array<char, block_size> tail;
+                tail.fill(delimiter);
+                std::memcpy(tail.data(), data + base, src.size() - base);
+                separators = separator_mask(tail.data(), delimiter);
+            }
+            const uint64_t shifted = (separators << 1) | separator_before;
+            uint64_t starts = ~separators & shifted;
+            uint64_t ends = separators & ~shifted;
+            separator_before = separators >> 63;
+
+            if (is_open && ends != 0) {
+                const auto token_end = base + static_cast<size_t>(std::countr_zero(ends));
+                ends &= ends - 1;
+                is_open = false;
+                if (const Status status = emit(open_token, token_end); status != Status::done) {
+                    return { count, open_token, status };
+                }
+            }
+            while (starts != 0) {
+                const auto token_begin = base + static_cast<size_t>(std::countr_zero(starts));
+                starts &= starts - 1;
+                if (ends == 0) {
+                    open_token = token_begin;
+                    is_open = true;
+                    break;
+                }
+                const auto token_end = base + static_cast<size_t>(std::countr_zero(ends));
+                ends &= ends - 1;
+                if (const Status status = emit(token_begin, token_end); status != Status::done) {
+                    return { count, token_begin, status };
+                }
+            }
+        }
+        if (is_open) {
+            if (const Status status = emit(open_token, src.size()); status != Status::done) {
+                return { count, open_token, status };
+            }
+        }
+        return { count, src.size(), Status::done };
+    }
+
+    template <typename T>
+    auto parse_error(const std::string_view src, const char delimiter, const Progress& progress, const size_t capacity) -> Utily::Error {
+        using Code = Utily::Error::Code;
+        if (progress.status == Status::full) {
+            return Utily::Error { std::floating_point<T> ? Code::too_many_floats : Code::too_many_integers, progress.offset, capacity };
+        }
+        const char separators[] = { delimiter, '\n', '\r' };
+        const size_t token_end = std::min(src.find_first_of(std::string_view { separators, 3 }, progress.offset), src.size());
+        const auto token = src.substr(progress.offset, token_end - progress.offset);
+        return Utily::Error { std::floating_point<T> ? Code::invalid_float : Code::invalid_integer, progress.offset }.with_detail(token);
+    }
+
+    template <typename T, typename Convert>
+    auto parse_into(const std::string_view src, const char delimiter, const std::span<T> out, const Convert& convert)
+        -> Utily::Result<size_t, Utily::Error> {
+        const Progress progress = parse_tokens(src, delimiter, out.data(), out.size(), convert);
+        if (progress.status != Status::done) {
+            return parse_error<T>(src, delimiter, progress, out.size());
+        }
+        return progress.count;
+    }
+
+    // Appends to a TypeErasedVector of T, growing it as the values run out of room.
+    template <typename T, typename Convert>
+    auto parse_into(const std::string_view src, const char delimiter, Utily::TypeErasedVector& out, const Convert& convert)
+        -> Utily::Result<size_t, Utily::Error> {
+        const size_t initial_size = out.size();
+        size_t offset = 0;
+        while (true) {
+            const size_t size = out.size();
+            // Numeric tokens rarely take fewer than 8 bytes with their separator, so this seldom grows twice.
+            out.resize(size + (src.size() - offset) / 8 + 16);
+            Progress progress = parse_tokens(src.substr(offset), delimiter, out.as_span<T>().data() + size, out.size() - size, convert);
+            out.resize(size + progress.count);
+            offset += progress.offset;
+            if (progress.status == Status::invalid) {
+                progress.offset = offset;
+                return parse_error<T>(src, delimiter, progress, 0);
+            }
+            if (progress.status == Status::done) {
+                return out.size() - initial_size;
+            }
+        }
+    }
+}
+
+namespace Utily {
+    /*
+     * Parses the integers in `src` separated by runs of `delimiter` or line breaks, so one call handles a whole
+     * CSV or space separated body. Gives the number of values written, or an error naming the first invalid
+     * token (or the first that didn't fit) and its offset.
+     */
+    template <std::integral T, size_t Extent>
+    auto parse_ints(const std::string_view src, const char delimiter, const std::span<T, Extent> out) -> Utily::Result<size_t, Utily::Error> {
+        return Parse::Details::parse_into<T>(src, delimiter, std::span<T> { out }, Parse::Details::parse_int<T>);
+    }
+
+    // Appends to `out`, which must hold T.
+    template <std::integral T>
+    auto parse_ints(const std::string_view src, const char delimiter, Utily::TypeErasedVector& out) -> Utily::Result<size_t, Utily::Error> {
+        return Parse::Details::parse_into<T>(src, delimiter, out, Parse::Details::parse_int<T>);
+    }
+
+    // As parse_ints, decimal and scientific notation, inf and nan.
+    template <std::floating_point T, size_t Extent>
+    auto parse_floats(const std::string_view src, const char delimiter, const std::span<T, Extent> out) -> Utily::Result<size_t, Utily::Error> {
+        return Parse::Details::parse_into<T>(src, delimiter, std::span<T> { out }, Parse::Details::parse_float<T>);
+    }
+
+    template <std::floating_point T>
+    auto parse_floats(const std::string_view src, const char delimiter, Utily::TypeErasedVector& out) -> Utily::Result<size_t, Utily::Error> {
+        return Parse::Details::parse_into<T>(src, delimiter, out, Parse::Details::parse_float<T>);
+    }
+
+}
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "Utily/Result.hpp"
+
+namespace Utily::Pipeline {
+    namespace Details {
+        template <typename T>
+        concept TupleLike = requires { std::tuple_size<std::remove_cvref_t<T>>::value; };
+
+        template <typename Sink, typename Value>
+        constexpr void push_into(Sink& sink, Value&& value) {
+            // TypeErasedVector checks the type it is handed, so never let a reference type through.
+            sink.push_back(std::remove_cvref_t<Value>(std::forward<Value>(value)));
+        }
+
+        /*
+         * One sink takes the whole value, several sinks take one tuple element each. The latter is
+         * how a transform returning a std::tuple/std::pair/std::array fills a struct of arrays.
+         */
+        template <typename Value, typename... Sinks>
+        constexpr void push_into_all(Value&& value, std::tuple<Sinks&...>& sinks) {
+            if constexpr (sizeof...(Sinks) == 1) {
+                push_into(std::get<0>(sinks), std::forward<Value>(value));
+            } else {
+                static_assert(TupleLike<Value>, "collect_into with several sinks needs a tuple-like value.");
+                static_assert(std::tuple_size_v<std::remove_cvref_t<Value>> == sizeof...(Sinks), "collect_into needs a sink per tuple element.");
+                [&]<size_t... I>(std::index_sequence<I...>) {
+                    (push_into(std::get<I>(sinks), std::get<I>(std::forward<Value>(value))), ...);
+                }(std::index_sequence_for<Sinks...> {});
+            }
+        }
+    }
+
+    /*
+     * A lazy view calling F on each element of Range as it is dereferenced. Holds Range by value when
+     * piped a temporary (e.g. the result of Utily::split) and by reference otherwise.
+     */
+    template <typename Range, typename F>
+    class Transformed
+    {
+        using Inner = std::remove_reference_t<Range>;
+        using InnerIter = std::ranges::iterator_t<const Inner>;
+        using InnerSentinel = std::ranges::sentinel_t<const Inner>;
+
+        Range _range;
+        F _f;
+
+    public:
+        constexpr Transformed(Range&& range, F f)
+            : _range(std::forward<Range>(range))
+            , _f(std::move(f)) { }
+
+        struct Sentinel {
+            InnerSentinel end;
+        };
+
+        struct Iterator {
+            InnerIter current;
+            const F* f = nullptr;
+
+            using difference_type = std::ptrdiff_t;
+            using value_type = std::remove_cvref_t<std::invoke_result_t<const F&, std::iter_reference_t<InnerIter>>>;
+
+            [[nodiscard]] constexpr auto operator*() const -> decltype(auto) {
+                return std::invoke(*f, *current);
+            }
+            constexpr auto operator++() -> Iterator& {
+                ++current;
+                return *this;
+            }
+            constexpr auto operator++(int) -> Iterator {
+                Iterator copy = *this;
+                ++current;
+                return copy;
+            }
+            [[nodiscard]] constexpr auto operator==(const Sentinel& sentinel) const -> bool {
+                return current == sentinel.end;
+            }
+        };
+
+        [[nodiscard]] constexpr auto begin() const -> Iterator {
+            return Iterator { .current = std::ranges::begin(std::as_const(_range)), .f = &_f };
+        }
+        [[nodiscard]] constexpr auto end() const -> Sentinel {
+            return Sentinel { .end = std::ranges::end(std::as_const(_range)) };
+        }
+    };
+
+    template <typename F>
+    struct TransformAdaptor {
+        F f;
+    };
+
+    template <typename... Sinks>
+    struct CollectAdaptor {
+        std::tuple<Sinks&...> sinks;
+    };
+
+    template <typename Range, typename F>
+        requires std::ranges::range<const std::remove_reference_t<Range>>
+    [[nodiscard]] constexpr auto operator|(Range&& range, TransformAdaptor<F> adaptor) {
+        return Transformed<Range, F> { std::forward<Range>(range), std::move(adaptor.f) };
+    }
+
+    /*
+     * Runs the pipeline, pushing each value into the sinks as it is produced and returning how many
+     * were collected. If the last stage returns a Utily::Result, collection stops at the first error,
+     * which is returned instead.
+     */
+    template <typename Range, typename... Sinks>
+        requires std::ranges::range<const std::remove_reference_t<Range>>
+    constexpr auto operator|(Range&& range, CollectAdaptor<Sinks...> adaptor) {
+        using Value = std::remove_cvref_t<decltype(*std::ranges::begin(std::as_const(range)))>;
+
+        if constexpr (ResultDetails::IsResultType<Value>) {
+            using Error = typename Value::error_type;
+            size_t count = 0;
+            for (auto&& result : std::as_const(range)) {
+                if (result.has_error()) {
+                    return Utily::Result<size_t, Error> { std::move(result.error()) };
+                }
+                Details::push_into_all(std::move(result.value()), adaptor.sinks);
+                ++count;
+            }
+            return Utily::Result<size_t, Error> { count };
+        } else {
+            size_t count = 0;
+            for (auto&& value : std::as_const(range)) {
+                Details::push_into_all(std::forward<decltype(value)>(value), adaptor.sinks);
+                ++count;
+            }
+            return count;
+        }
+    }
+}
+
+namespace Utily {
+    /*
+     * Range adaptors fusing every stage into the one loop that collect_into runs, so a
+     *      Utily::split(text, '\n') | Utily::transform(parse) | Utily::collect_into(xs, ys, zs)
+     * never builds a vector of tokens. A sink is anything with push_back, e.g. std::vector,
+     * Utily::StaticVector or Utily::TypeErasedVector. StaticVector asserts if it runs out of room.
+     */
+    template <typename F>
+    [[nodiscard]] constexpr auto transform(F f) -> Pipeline::TransformAdaptor<F> {
+        return Pipeline::TransformAdaptor<F> { std::move(f) };
+    }
+
+    template <typename... Sinks>
+        requires(sizeof...(Sinks) > 0)
+    [[nodiscard]] constexpr auto collect_into(Sinks&... sinks) -> Pipeline::CollectAdaptor<Sinks...> {
+        return Pipeline::CollectAdaptor<Sinks...> { std::tie(sinks...) };
+    }
+}
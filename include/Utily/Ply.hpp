@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <utility>
+
+#include "Utily/Error.hpp"
+#include "Utily/Result.hpp"
+
+namespace Utily {
+    /*
+     * Loads triangle meshes from PLY files, ASCII or binary little-endian. Only the vertex positions
+     * and the face indices are kept, both in one InlineArrays block, other properties and elements
+     * are skipped. Faces must be triangles.
+     */
+    class Ply
+    {
+    public:
+        struct Mesh {
+            std::unique_ptr<std::byte[]> owner;
+            std::span<float> positions;  // x, y, z per vertex.
+            std::span<uint32_t> indices; // three per triangle.
+
+            [[nodiscard]] auto vertex_count() const noexcept -> size_t { return positions.size() / 3; }
+            [[nodiscard]] auto triangle_count() const noexcept -> size_t { return indices.size() / 3; }
+        };
+
+        struct Options {
+            // Upper limit, each thread is given at least min_bytes_per_thread of an ASCII element.
+            size_t max_threads = 1;
+            size_t min_bytes_per_thread = size_t { 1 } << 20;
+        };
+
+        static auto load(std::filesystem::path file_path, const Options& options)
+            -> Utily::Result<Mesh, Utily::Error>;
+        static auto load(std::filesystem::path file_path) -> Utily::Result<Mesh, Utily::Error> {
+            return load(std::move(file_path), Options {});
+        }
+
+        // As load, from a file already in memory.
+        static auto parse(std::span<const uint8_t> data, const Options& options)
+            -> Utily::Result<Mesh, Utily::Error>;
+        static auto parse(std::span<const uint8_t> data) -> Utily::Result<Mesh, Utily::Error> {
+            return parse(data, Options {});
+        }
+    };
+}
@@ -1,13 +1,532 @@
 #pragma once
 
+#include "Utily/TupleAlgo.hpp"
+
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <iostream>
+#include <limits>
 #include <optional>
 #include <source_location>
 #include <string_view>
+#include <tuple>
 #include <type_traits>
+#include <utility>
+
+namespace Utily {
+    /*
+     * The values enum reflection scans for enumerators. Specialise it for enums with values outside
+     * the default, the cost is one template instantiation per candidate value.
+     */
+    template <typename E>
+    struct EnumRange {
+        using Underlying = std::underlying_type_t<E>;
+        constexpr static int64_t min = std::is_signed_v<Underlying> ? -128 : 0;
+        constexpr static int64_t max = std::min<int64_t>(127, static_cast<int64_t>(std::numeric_limits<Underlying>::max()));
+    };
+}
+
+namespace Utily::ReflectionDetails {
+    // Converts to any field type, used to count an aggregate's fields by brace-initialising it.
+    // Not constexpr, so constructors that accept anything (e.g. StaticVector's) never evaluate it.
+    struct AnyField {
+        template <typename T>
+        operator T&() const noexcept;
+    };
+
+    template <typename T, size_t... I>
+    concept BraceConstructibleWith = requires { T { (static_cast<void>(I), AnyField {})... }; };
+
+    template <typename T, size_t N = 0>
+    consteval auto count_fields() -> size_t {
+        if constexpr ([]<size_t... I>(std::index_sequence<I...>) { return BraceConstructibleWith<T, I...>; }(std::make_index_sequence<N + 1> {})) {
+            return count_fields<T, N + 1>();
+        } else {
+            return N;
+        }
+    }
+
+    // Never defined, only its members' addresses are named at compile time.
+    template <typename T>
+    extern const T fake_object;
+
+    template <size_t Count, typename T>
+    constexpr auto tie_fields(T& obj) {
+            if constexpr (Count == 0) {
+                return std::tuple<> {};
+            } else if constexpr (Count == 1) {
+                auto& [f0] = obj;
+                return std::tie(f0);
+            } else if constexpr (Count == 2) {
+                auto& [f0, f1] = obj;
+                return std::tie(f0, f1);
+            } else if constexpr (Count == 3) {
+                auto& [f0, f1, f2] = obj;
+                return std::tie(f0, f1, f2);
+            } else if constexpr (Count == 4) {
+                auto& [f0, f1, f2, f3] = obj;
+                return std::tie(f0, f1, f2, f3);
+            } else if constexpr (Count == 5) {
+                auto& [f0, f1, f2, f3, f4] = obj;
+                return std::tie(f0, f1, f2, f3, f4);
+            } else if constexpr (Count == 6) {
+                auto& [f0, f1, f2, f3, f4, f5] = obj;
+                return std::tie(f0, f1, f2, f3, f4, f5);
+            } else if constexpr (Count == 7) {
+                auto& [f0, f1, f2, f3, f4, f5, f6] = obj;
+                return std::tie(f0, f1, f2, f3, f4, f5, f6);
+            } else if constexpr (Count == 8) {
+                auto& [f0, f1, f2, f3, f4, f5, f6, f7] = obj;
+                return std::tie(f0, f1, f2, f3, f4, f5, f6, f7);
+            } else if constexpr (Count == 9) {
+                auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8] = obj;
+                return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8);
+            } else if constexpr (Count == 10) {
+                auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9] = obj;
+                return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9);
+            } else if constexpr (Count == 11) {
+                auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10] = obj;
+                return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10);
+            } else if constexpr (Count == 12) {
+                auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11] = obj;
+                return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11);
+            } else if constexpr (Count == 13) {
+                auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12] = obj;
+                return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12);
+            } else if constexpr (Count == 14) {
+                auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13] = obj;
+                return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13);
+            } else if constexpr (Count == 15) {
+                auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14] = obj;
+                return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14);
+            } else if constexpr (Count == 16) {
+                auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15] = obj;
+                return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15);
+            } else if constexpr (Count == 17) {
+                auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16] = obj;
+                return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16);
+            } else if constexpr (Count == 18) {
+                auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17] = obj;
+                return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17);
+            } else if constexpr (Count == 19) {
+                auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18] = obj;
+                return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18);
+            } else if constexpr (Count == 20) {
+                auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19] = obj;
+                return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19);
+            } else if constexpr (Count == 21) {
+                auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20] = obj;
+                return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20);
+            } else if constexpr (Count == 22) {
+                auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21] = obj;
+                return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21);
+            } else if constexpr (Count == 23) {
+                auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22] = obj;
+                return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22);
+            } else if constexpr (Count == 24) {
+                auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23] = obj;
+                return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23);
+            } else if constexpr (Count == 25) {
+                auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24] = obj;
+                return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24);
+            } else if constexpr (Count == 26) {
+                auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25] = obj;
+                return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25);
+            } else if constexpr (Count == 27) {
+                auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26] = obj;
+                return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26);
+            } else if constexpr (Count == 28) {
+                auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27] = obj;
+                return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27);
+            } else if constexpr (Count == 29) {
+                auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28] = obj;
+                return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28);
+            } else if constexpr (Count == 30) {
+                auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29] = obj;
+                return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29);
+            } else if constexpr (Count == 31) {
+                auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30] = obj;
+                return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30);
+            } else if constexpr (Count == 32) {
+                auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31] = obj;
+                return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31);
+            } else {
+                static_assert(Count <= 32, "Reflection supports aggregates of up to 32 fields.");
+                return std::tuple<> {};
+            }
+    }
+
+    // Whether the first scalar of `value`, reached through first fields and first elements, is non-zero.
+    template <typename T>
+    constexpr auto leads_with_nonzero(const T& value) -> bool {
+        if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+            return value != T {};
+        } else if constexpr (std::is_array_v<T>) {
+            return leads_with_nonzero(value[0]);
+        } else if constexpr (requires { std::tuple_size<T>::value; }) {
+            return leads_with_nonzero(std::get<0>(value));
+        } else {
+            static_assert(count_fields<T>() > 0, "Field offsets need every field to start with a scalar.");
+            return leads_with_nonzero(std::get<0>(tie_fields<count_fields<T>()>(value)));
+        }
+    }
+
+    /*
+     * The offset of field Index as the compiler laid it out, alignas included. T is bit_cast from bytes
+     * [0, last] set to 1 and the rest 0. The smallest `last` that makes the field's first scalar non-zero
+     * is the field's first byte, found by binary search.
+     */
+    template <typename T, size_t Index>
+    consteval auto field_offset() -> size_t {
+        const auto reaches = [](const size_t last) {
+            std::array<unsigned char, sizeof(T)> bytes {};
+            for (size_t i = 0; i <= last; ++i) {
+                bytes[i] = 1;
+            }
+            const T value = std::bit_cast<T>(bytes);
+            return leads_with_nonzero(std::get<Index>(tie_fields<count_fields<T>()>(value)));
+        };
+        size_t low = 0;
+        size_t high = sizeof(T) - 1;
+        while (low < high) {
+            const size_t middle = low + (high - low) / 2;
+            if (reaches(middle)) {
+                high = middle;
+            } else {
+                low = middle + 1;
+            }
+        }
+        return low;
+    }
+
+    template <auto FieldPtr>
+    consteval auto field_pointer_signature() -> std::string_view {
+#if defined(__clang__) || defined(__GNUC__)
+        return { __PRETTY_FUNCTION__ };
+#else
+        return std::source_location::current().function_name();
+#endif
+    }
+
+    constexpr auto is_identifier_char(const char c) -> bool {
+        return c == '_' || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+    }
+
+    // The member's name is the identifier just before the end of FieldPtr in the signature, e.g.
+    // GCC "[with auto FieldPtr = (& fake_object<Vec3>.Vec3::x)]", Clang "[FieldPtr = &fake_object.x]".
+    consteval auto parse_field_name(const std::string_view signature) -> std::string_view {
+#if defined(__clang__)
+        constexpr std::string_view end_marker = "]";
+#elif defined(__GNUC__)
+        constexpr std::string_view end_marker = ")";
+#else
+        constexpr std::string_view end_marker = ">(void)";
+#endif
+        const size_t object = signature.find("fake_object");
+        const size_t end = signature.find(end_marker, object);
+        size_t begin = end;
+        while (begin > object && is_identifier_char(signature[begin - 1])) {
+            --begin;
+        }
+        return signature.substr(begin, end - begin);
+    }
+
+    // The end of the type starting at `begin` in a GCC/Clang signature, the first ';' or ']' outside any
+    // brackets, e.g. "std::pair<int, float>" in "[with T = std::pair<int, float>; ...]".
+    consteval auto type_name_end(const std::string_view signature, const size_t begin) -> size_t {
+        int depth = 0;
+        for (size_t i = begin; i < signature.size(); ++i) {
+            const char c = signature[i];
+            if (c == '<' || c == '(' || c == '[') {
+                ++depth;
+            } else if (depth > 0 && (c == '>' || c == ')' || c == ']')) {
+                --depth;
+            } else if (depth == 0 && (c == ';' || c == ']')) {
+                return i;
+            }
+        }
+        return signature.size();
+    }
+
+    struct Fnv1a {
+        uint64_t hash = 14695981039346656037ull;
+
+        constexpr void add(const std::string_view text) {
+            for (const char c : text) {
+                hash = (hash ^ static_cast<uint8_t>(c)) * 1099511628211ull;
+            }
+        }
+    };
+
+    /*
+     * Hashes a type name as printed by any of GCC, Clang or MSVC to the same value. The differences
+     * normalised away are spacing, "struct "/"class "/"enum "/"union " prefixes and the spelling of
+     * integer types ("long unsigned int", "unsigned long", "unsigned __int64" and so on).
+     */
+    consteval auto hash_type_name(const std::string_view name) -> uint64_t {
+        Fnv1a fnv;
+        bool last_was_identifier = false;
+        const auto emit_identifier = [&](const std::string_view token) {
+            if (last_was_identifier) {
+                fnv.add(" ");
+            }
+            fnv.add(token);
+            last_was_identifier = true;
+        };
+        const auto read_token = [&](size_t pos) {
+            size_t end = pos;
+            while (end < name.size() && is_identifier_char(name[end])) {
+                ++end;
+            }
+            return name.substr(pos, end - pos);
+        };
+        const auto is_integer_keyword = [](const std::string_view token) {
+            return token == "unsigned" || token == "signed" || token == "short" || token == "long"
+                || token == "int" || token == "char" || token == "__int64";
+        };
+
+        size_t i = 0;
+        while (i < name.size()) {
+            if (name[i] == ' ') {
+                ++i;
+                continue;
+            }
+            if (!is_identifier_char(name[i])) {
+                fnv.add(name.substr(i, 1));
+                last_was_identifier = false;
+                ++i;
+                continue;
+            }
+
+            const auto token = read_token(i);
+            if (token == "struct" || token == "class" || token == "enum" || token == "union") {
+                i += token.size();
+                continue;
+            }
+            if (!is_integer_keyword(token)) {
+                emit_identifier(token);
+                i += token.size();
+                continue;
+            }
+
+            int longs = 0;
+            bool is_unsigned = false;
+            bool is_signed = false;
+            bool is_short = false;
+            bool is_char = false;
+            size_t next = i;
+            while (true) {
+                while (next < name.size() && name[next] == ' ') {
+                    ++next;
+                }
+                const auto keyword = read_token(next);
+                if (keyword.empty() || !is_integer_keyword(keyword)) {
+                    break;
+                }
+                longs += keyword == "long" ? 1 : keyword == "__int64" ? 2 : 0;
+                is_unsigned |= keyword == "unsigned";
+                is_signed |= keyword == "signed";
+                is_short |= keyword == "short";
+                is_char |= keyword == "char";
+                next += keyword.size();
+                i = next;
+            }
+            if (is_unsigned) {
+                emit_identifier("unsigned");
+            } else if (is_signed && is_char) {
+                emit_identifier("signed");
+            }
+            if (is_char) {
+                emit_identifier("char");
+            } else if (is_short) {
+                emit_identifier("short");
+            } else if (longs > 0) {
+                emit_identifier("long");
+                if (longs > 1) {
+                    emit_identifier("long");
+                }
+            } else {
+                emit_identifier("int");
+            }
+        }
+        return fnv.hash;
+    }
+
+    template <typename E, E Value>
+    consteval auto enum_value_signature() -> std::string_view {
+#if defined(__clang__) || defined(__GNUC__)
+        return { __PRETTY_FUNCTION__ };
+#else
+        return std::source_location::current().function_name();
+#endif
+    }
+
+    // The enumerator is the identifier ending Value in the signature, e.g. GCC "[with E = Color; E Value = Color::red; ...]".
+    // Values without an enumerator print as a cast instead, "(Color)2", which leaves a number.
+    consteval auto parse_enum_name(const std::string_view signature) -> std::string_view {
+#if defined(__clang__) || defined(__GNUC__)
+        const size_t end = signature.find_first_of(";]", signature.find("Value = "));
+#else
+        const size_t end = signature.rfind(">(void)");
+#endif
+        size_t begin = end;
+        while (begin > 0 && is_identifier_char(signature[begin - 1])) {
+            --begin;
+        }
+        if (begin == end || (signature[begin] >= '0' && signature[begin] <= '9')) {
+            return {};
+        }
+        return signature.substr(begin, end - begin);
+    }
+
+    template <typename E>
+    constexpr auto enum_integer(const E value) noexcept -> int64_t {
+        return static_cast<int64_t>(static_cast<std::underlying_type_t<E>>(value));
+    }
+
+    template <typename E>
+    constexpr auto enum_candidate(const size_t index) -> E {
+        return static_cast<E>(static_cast<std::underlying_type_t<E>>(EnumRange<E>::min + static_cast<int64_t>(index)));
+    }
+
+    // The name of every value in EnumRange<E>, empty where there is no enumerator.
+    template <typename E>
+    constexpr auto enum_candidate_names = []<size_t... I>(std::index_sequence<I...>) {
+        return std::array<std::string_view, sizeof...(I)> { parse_enum_name(enum_value_signature<E, enum_candidate<E>(I)>())... };
+    }(std::make_index_sequence<static_cast<size_t>(EnumRange<E>::max - EnumRange<E>::min + 1)> {});
+
+    template <typename E>
+    constexpr size_t enum_count = static_cast<size_t>(
+        std::count_if(enum_candidate_names<E>.begin(), enum_candidate_names<E>.end(), [](std::string_view name) { return !name.empty(); }));
+
+    template <typename E>
+    struct EnumEntry {
+        std::string_view name;
+        E value;
+    };
+
+    // Enumerators ordered by value, as scanned.
+    template <typename E>
+    constexpr auto enum_entries = [] {
+        std::array<EnumEntry<E>, enum_count<E>> entries {};
+        size_t n = 0;
+        for (size_t i = 0; i < enum_candidate_names<E>.size(); ++i) {
+            if (!enum_candidate_names<E>[i].empty()) {
+                entries[n++] = { enum_candidate_names<E>[i], enum_candidate<E>(i) };
+            }
+        }
+        return entries;
+    }();
+
+    template <typename E>
+    constexpr auto enum_values = [] {
+        std::array<E, enum_count<E>> values {};
+        std::transform(enum_entries<E>.begin(), enum_entries<E>.end(), values.begin(), [](const EnumEntry<E>& entry) { return entry.value; });
+        return values;
+    }();
+
+    // Enumerators ordered by name, for binary searching strings.
+    template <typename E>
+    constexpr auto enum_entries_by_name = [] {
+        auto entries = enum_entries<E>;
+        std::sort(entries.begin(), entries.end(), [](const EnumEntry<E>& lhs, const EnumEntry<E>& rhs) { return lhs.name < rhs.name; });
+        return entries;
+    }();
+
+    // Up to 8 bytes as a little-endian word, the same at compile time and run time. At run time the
+    // bytes are gathered with two overlapping loads rather than a loop.
+    constexpr auto read_word(const char* data, const size_t size) noexcept -> uint64_t {
+        const auto byte = [&](size_t i) { return static_cast<uint64_t>(static_cast<uint8_t>(data[i])) << (8 * i); };
+        if (std::is_constant_evaluated() || std::endian::native != std::endian::little) {
+            uint64_t word = 0;
+            for (size_t i = 0; i < size; ++i) {
+                word |= byte(i);
+            }
+            return word;
+        }
+        if (size >= 4) {
+            uint32_t low;
+            uint32_t high;
+            std::memcpy(&low, data, sizeof(low));
+            std::memcpy(&high, data + size - 4, sizeof(high));
+            return low | (static_cast<uint64_t>(high) << (8 * (size - 4)));
+        }
+        return size == 0 ? 0 : byte(0) | byte(size / 2) | byte(size - 1);
+    }
+
+    // The length and first and last 8 bytes of a name, which fully describe names of up to 16 bytes.
+    struct EnumNameKey {
+        uint64_t head;
+        uint64_t tail;
+        size_t size;
+
+        constexpr auto operator==(const EnumNameKey&) const noexcept -> bool = default;
+    };
+
+    constexpr auto enum_name_key(const std::string_view name) noexcept -> EnumNameKey {
+        if (name.size() >= 8) {
+            return { read_word(name.data(), 8), read_word(name.data() + name.size() - 8, 8), name.size() };
+        }
+        const uint64_t word = read_word(name.data(), name.size());
+        return { word, word, name.size() };
+    }
+
+    // The top bits of the product pick the slot.
+    constexpr auto enum_name_hash(const EnumNameKey& key, const uint64_t seed, const int shift) noexcept -> size_t {
+        return static_cast<size_t>(((key.head ^ (key.tail * 0x9E3779B97F4A7C15ull) ^ key.size) * seed) >> shift);
+    }
+
+    template <size_t Count, size_t Slots>
+    struct EnumNameTable {
+        uint64_t seed = 1;
+        int shift = 64 - std::countr_zero(Slots);
+        bool is_perfect = false;
+        std::array<uint16_t, Slots> slots {}; // index + 1 into enum_entries, 0 for an empty slot.
+        std::array<EnumNameKey, Count> keys {};
+    };
+
+    /*
+     * A perfect hash of the enumerator names: the seed is searched for at compile time until no two
+     * names share a slot. A lookup then hashes once and compares keys, only names longer than 16
+     * bytes compare their text too. Names with equal keys leave is_perfect false and lookups fall
+     * back to binary search.
+     */
+    template <typename E>
+    constexpr auto enum_name_table = [] {
+        static_assert(enum_count<E> < std::numeric_limits<uint16_t>::max());
+        constexpr size_t slots = std::bit_ceil(std::max<size_t>(enum_count<E> * 2, 2));
+        EnumNameTable<enum_count<E>, slots> table;
+        for (size_t i = 0; i < enum_count<E>; ++i) {
+            table.keys[i] = enum_name_key(enum_entries<E>[i].name);
+        }
+        for (uint64_t attempt = 0; attempt < 1024 && !table.is_perfect; ++attempt) {
+            table.seed = (attempt * 0x9E3779B97F4A7C15ull) | 1;
+            table.slots = {};
+            table.is_perfect = true;
+            for (size_t i = 0; i < enum_count<E> && table.is_perfect; ++i) {
+                auto& slot = table.slots[enum_name_hash(table.keys[i], table.seed, table.shift)];
+                table.is_perfect = slot == 0;
+                slot = static_cast<uint16_t>(i + 1);
+            }
+        }
+        return table;
+    }();
+
+    // Without gaps a value's entry is found by subtraction rather than a search.
+    template <typename E>
+    constexpr bool enum_is_contiguous = [] {
+        for (size_t i = 1; i < enum_count<E>; ++i) {
+            if (enum_integer(enum_entries<E>[i].value) != enum_integer(enum_entries<E>[0].value) + static_cast<int64_t>(i)) {
+                return false;
+            }
+        }
+        return true;
+    }();
+}
 
 namespace Utily {
     struct Reflection {
@@ -37,12 +556,145 @@ namespace Utily {
                 return std::string_view { begin, end };
             } else {
                 // This is GCC and Clang
-                begin += static_cast<std::ptrdiff_t>(t_equals.size());
-                std::string_view end_delims = " ;]";
-                auto end = std::find_first_of(begin, name.end(), end_delims.begin(), end_delims.end());
-                return std::string_view { begin, end };
+                const auto offset = static_cast<size_t>(begin - name.begin()) + t_equals.size();
+                return name.substr(offset, ReflectionDetails::type_name_end(name, offset) - offset);
             }
             return name;
         }
+
+        struct TypeInfo {
+            uint64_t id;
+            std::string_view name;
+            size_t size;
+            size_t alignment;
+            bool is_trivially_copyable;
+            bool is_trivially_destructible;
+            bool is_trivially_default_constructible;
+        };
+
+        // 64-bit FNV-1a of the normalised full type name, the same from GCC, Clang and MSVC for the same spelling.
+        template <typename T>
+        consteval static auto get_type_id() -> uint64_t {
+            return ReflectionDetails::hash_type_name(get_type_name<T>());
+        }
+
+        template <typename T>
+        consteval static auto get_type_info() -> TypeInfo {
+            return TypeInfo {
+                .id = get_type_id<T>(),
+                .name = get_type_name<T>(),
+                .size = sizeof(T),
+                .alignment = alignof(T),
+                .is_trivially_copyable = std::is_trivially_copyable_v<T>,
+                .is_trivially_destructible = std::is_trivially_destructible_v<T>,
+                .is_trivially_default_constructible = std::is_trivially_default_constructible_v<T>
+            };
+        }
+
+        /*
+         * Enum reflection. Enumerators are found at compile time by scanning EnumRange<E>. Names are
+         * looked up by index when the values are contiguous and by binary search otherwise, strings by
+         * a perfect hash built at compile time. Aliases (two enumerators with the
+         * same value) report the first. Unscoped enums without a fixed underlying type are only
+         * reliable when all the scanned values fit in the enum.
+         */
+        template <typename E>
+            requires std::is_enum_v<E>
+        constexpr static auto enum_values() noexcept -> const std::array<E, ReflectionDetails::enum_count<E>>& {
+            return ReflectionDetails::enum_values<E>;
+        }
+
+        // Empty when value has no enumerator.
+        template <typename E>
+            requires std::is_enum_v<E>
+        constexpr static auto enum_name(const E value) noexcept -> std::string_view {
+            constexpr const auto& entries = ReflectionDetails::enum_entries<E>;
+            if constexpr (entries.empty()) {
+                return {};
+            } else if constexpr (ReflectionDetails::enum_is_contiguous<E>) {
+                const int64_t index = ReflectionDetails::enum_integer(value) - ReflectionDetails::enum_integer(entries[0].value);
+                if (index < 0 || index >= static_cast<int64_t>(entries.size())) {
+                    return {};
+                }
+                return entries[static_cast<size_t>(index)].name;
+            } else {
+                const auto it = std::lower_bound(entries.begin(), entries.end(), value, [](const auto& entry, E v) {
+                    return ReflectionDetails::enum_integer(entry.value) < ReflectionDetails::enum_integer(v);
+                });
+                return it != entries.end() && it->value == value ? it->name : std::string_view {};
+            }
+        }
+
+        template <typename E>
+            requires std::is_enum_v<E>
+        constexpr static auto enum_from_string(const std::string_view name) noexcept -> std::optional<E> {
+            constexpr const auto& table = ReflectionDetails::enum_name_table<E>;
+            if constexpr (table.is_perfect) {
+                constexpr const auto& entries = ReflectionDetails::enum_entries<E>;
+                const auto key = ReflectionDetails::enum_name_key(name);
+                const uint16_t slot = table.slots[ReflectionDetails::enum_name_hash(key, table.seed, table.shift)];
+                if (slot != 0 && table.keys[slot - 1] == key && (key.size <= 16 || entries[slot - 1].name == name)) {
+                    return entries[slot - 1].value;
+                }
+                return std::nullopt;
+            } else {
+                constexpr const auto& entries = ReflectionDetails::enum_entries_by_name<E>;
+                const auto it = std::lower_bound(entries.begin(), entries.end(), name, [](const auto& entry, std::string_view n) {
+                    return entry.name < n;
+                });
+                if (it != entries.end() && it->name == name) {
+                    return it->value;
+                }
+                return std::nullopt;
+            }
+        }
+
+        /*
+         * Field introspection for aggregates: plain structs without base classes, C arrays or reference
+         * members, of up to 32 fields. Everything is worked out at compile time.
+         */
+        template <typename T>
+            requires std::is_aggregate_v<T>
+        constexpr static size_t field_count = ReflectionDetails::count_fields<T>();
+
+        // The fields of obj as a tuple of references.
+        template <typename T>
+            requires std::is_aggregate_v<std::remove_const_t<T>>
+        constexpr static auto tie_fields(T& obj) {
+            return ReflectionDetails::tie_fields<field_count<std::remove_const_t<T>>>(obj);
+        }
+
+        template <typename T, size_t Index>
+        using field_type = std::remove_cvref_t<std::tuple_element_t<Index, decltype(tie_fields(std::declval<T&>()))>>;
+
+        // Where the compiler placed the field, alignas and all. Needs a bit_cast-able T.
+        template <typename T, size_t Index>
+            requires(std::is_standard_layout_v<T> && std::is_trivially_copyable_v<T>)
+        consteval static auto get_field_offset() -> size_t {
+            return ReflectionDetails::field_offset<T, Index>();
+        }
+
+        template <typename T, size_t Index>
+        consteval static auto get_field_name() -> std::string_view {
+            return ReflectionDetails::parse_field_name(
+                ReflectionDetails::field_pointer_signature<&std::get<Index>(tie_fields(ReflectionDetails::fake_object<T>))>());
+        }
+
+        // Calls f(field) for each field in declaration order, expanded through TupleAlgo::for_each.
+        template <typename T, typename F>
+        constexpr static void for_each_field(T& obj, F f) {
+            auto fields = tie_fields(obj);
+            Utily::TupleAlgo::for_each(fields, f);
+        }
+
+        // Calls f(name, field) for each field in declaration order.
+        template <typename T, typename F>
+        constexpr static void for_each_named_field(T& obj, F f) {
+            using Type = std::remove_const_t<T>;
+            auto fields = tie_fields(obj);
+            [&]<size_t... I>(std::index_sequence<I...>) {
+                (f(get_field_name<Type, I>(), std::get<I>(fields)), ...);
+            }(std::make_index_sequence<field_count<Type>> {});
+        }
     };
 }
\ No newline at end of file
@@ -2,26 +2,175 @@
 
 #include "Utily/Concepts.hpp"
 
+#include <cassert>
+#include <functional>
+#include <memory>
 #include <optional>
+#include <stdexcept>
 #include <type_traits>
-#include <variant>
+#include <utility>
 
 namespace Utily {
+    template <typename Value, typename Error>
+        requires(!std::same_as<Value, Error>)
+    class Result;
+
+    namespace ResultDetails {
+        template <typename T>
+        struct IsResult : std::false_type { };
+        template <typename Value, typename Error>
+        struct IsResult<Utily::Result<Value, Error>> : std::true_type { };
+
+        template <typename T>
+        concept IsResultType = IsResult<std::remove_cvref_t<T>>::value;
+
+        // False, but only once T is known, so a static_assert on it fires in the branch that's taken.
+        template <typename T>
+        constexpr bool always_false = false;
+
+        // The member of self, moved from when self is an rvalue.
+        template <typename Self, typename Member>
+        constexpr auto forward_member(Member& member) noexcept -> decltype(auto) {
+            if constexpr (std::is_rvalue_reference_v<Self&&>) {
+                return std::move(member);
+            } else {
+                return static_cast<Member&>(member);
+            }
+        }
+    }
+
+    /*
+     * Value or Error in a union behind a single bool. Trivially copyable and destructible when both
+     * sides are, so a small Result (e.g. Result<uint32_t, ErrorCode>) is returned in registers.
+     */
     template <typename Value, typename Error>
         requires(!std::same_as<Value, Error>)
     class Result
     {
     private:
-        using V = std::optional<Value>;
-        using E = std::optional<Error>;
-        using InternalResult = std::variant<V, E>;
-        InternalResult _result;
+        union {
+            Value _value;
+            Error _error;
+        };
+        bool _has_value;
+
+        constexpr static bool trivially_copyable = std::is_trivially_copy_constructible_v<Value> && std::is_trivially_copy_constructible_v<Error>
+            && std::is_trivially_copy_assignable_v<Value> && std::is_trivially_copy_assignable_v<Error>;
+        constexpr static bool trivially_movable = std::is_trivially_move_constructible_v<Value> && std::is_trivially_move_constructible_v<Error>
+            && std::is_trivially_move_assignable_v<Value> && std::is_trivially_move_assignable_v<Error>;
+        constexpr static bool trivially_destructible = std::is_trivially_destructible_v<Value> && std::is_trivially_destructible_v<Error>;
+
+        // Falls back to copying for types with a deleted move constructor.
+        template <typename T>
+        constexpr static auto move_or_copy(T& t) noexcept -> std::conditional_t<std::is_move_constructible_v<T>, T&&, const T&> {
+            return std::move(t);
+        }
+
+        constexpr void destroy() noexcept {
+            if (_has_value) {
+                std::destroy_at(&_value);
+            } else {
+                std::destroy_at(&_error);
+            }
+        }
+
+        template <typename Other>
+        constexpr void construct_from(Other&& other) {
+            if (other._has_value) {
+                if constexpr (std::is_rvalue_reference_v<Other&&>) {
+                    std::construct_at(&_value, move_or_copy(other._value));
+                } else {
+                    std::construct_at(&_value, other._value);
+                }
+            } else {
+                if constexpr (std::is_rvalue_reference_v<Other&&>) {
+                    std::construct_at(&_error, move_or_copy(other._error));
+                } else {
+                    std::construct_at(&_error, other._error);
+                }
+            }
+            _has_value = other._has_value;
+        }
+
+        /*
+         * Assigns without ever leaving *this naming a destroyed member. When constructing from other
+         * could throw, the copy is made first and *this is only touched once it succeeded. Moving that
+         * copy in is noexcept, so a throwing move constructor there terminates.
+         */
+        template <typename Other>
+        constexpr void assign_from(Other&& other) {
+            constexpr bool nothrow = std::is_rvalue_reference_v<Other&&>
+                ? std::is_nothrow_move_constructible_v<Value> && std::is_nothrow_move_constructible_v<Error>
+                : std::is_nothrow_copy_constructible_v<Value> && std::is_nothrow_copy_constructible_v<Error>;
+            if constexpr (nothrow) {
+                destroy();
+                construct_from(std::forward<Other>(other));
+            } else {
+                Result temp { std::forward<Other>(other) };
+                replace_with(std::move(temp));
+            }
+        }
+
+        constexpr void replace_with(Result&& other) noexcept {
+            destroy();
+            construct_from(std::move(other));
+        }
+
+        template <typename Self, typename F>
+        constexpr static auto and_then_impl(Self&& self, F&& f) {
+            using Next = std::remove_cvref_t<std::invoke_result_t<F, decltype(ResultDetails::forward_member<Self>(self._value))>>;
+            static_assert(ResultDetails::IsResultType<Next>, "and_then needs a function returning a Result.");
+            static_assert(std::same_as<typename Next::error_type, Error>, "and_then can't change the error type, use transform_error.");
+            if (self._has_value) {
+                return std::invoke(std::forward<F>(f), ResultDetails::forward_member<Self>(self._value));
+            }
+            return Next { ResultDetails::forward_member<Self>(self._error) };
+        }
+
+        template <typename Self, typename F>
+        constexpr static auto transform_impl(Self&& self, F&& f) {
+            using NextValue = std::remove_cvref_t<std::invoke_result_t<F, decltype(ResultDetails::forward_member<Self>(self._value))>>;
+            using Next = Result<NextValue, Error>;
+            if (self._has_value) {
+                if constexpr (std::is_void_v<NextValue>) {
+                    std::invoke(std::forward<F>(f), ResultDetails::forward_member<Self>(self._value));
+                    return Next {};
+                } else {
+                    return Next { std::invoke(std::forward<F>(f), ResultDetails::forward_member<Self>(self._value)) };
+                }
+            }
+            return Next { ResultDetails::forward_member<Self>(self._error) };
+        }
+
+        template <typename Self, typename F>
+        constexpr static auto transform_error_impl(Self&& self, F&& f) {
+            using NextError = std::remove_cvref_t<std::invoke_result_t<F, decltype(ResultDetails::forward_member<Self>(self._error))>>;
+            using Next = Result<Value, NextError>;
+            if (self._has_value) {
+                return Next { ResultDetails::forward_member<Self>(self._value) };
+            }
+            return Next { std::invoke(std::forward<F>(f), ResultDetails::forward_member<Self>(self._error)) };
+        }
+
+        template <typename Self, typename F>
+        constexpr static auto or_else_impl(Self&& self, F&& f) {
+            using Next = std::remove_cvref_t<std::invoke_result_t<F, decltype(ResultDetails::forward_member<Self>(self._error))>>;
+            static_assert(ResultDetails::IsResultType<Next>, "or_else needs a function returning a Result.");
+            static_assert(std::same_as<typename Next::value_type, Value>, "or_else can't change the value type, use transform.");
+            if (self._has_value) {
+                return Next { ResultDetails::forward_member<Self>(self._value) };
+            }
+            return std::invoke(std::forward<F>(f), ResultDetails::forward_member<Self>(self._error));
+        }
 
     public:
+        using value_type = Value;
+        using error_type = Error;
+
         constexpr Result() = delete;
 
         template <typename Arg>
-            requires(!std::is_reference_v<Arg>)
+            requires(!std::is_reference_v<Arg> && !std::same_as<Arg, Result>)
         constexpr Result(Arg&& arg) {
             /*
             The constructors have a lot of noise but it means that a type
@@ -29,62 +178,177 @@ namespace Utily {
             */
             if constexpr (std::same_as<Arg, Value>) {
                 static_assert(Utily::Concepts::HasMoveConstructor<Value>, "Result Value type has no move constructor");
-                std::construct_at(&_result, std::forward<Value>(arg));
+                std::construct_at(&_value, std::forward<Value>(arg));
+                _has_value = true;
             } else if constexpr (std::same_as<Arg, Error>) {
                 static_assert(Utily::Concepts::HasMoveConstructor<Error>, "Result Error type has no move constructor");
-                std::construct_at(&_result, std::forward<Error>(arg));
+                std::construct_at(&_error, std::forward<Error>(arg));
+                _has_value = false;
             } else if constexpr (std::is_constructible_v<Value, Arg&&> && std::is_constructible_v<Error, Arg&&>) {
-                static_assert(std::is_constructible_v<Value, Arg&&> && std::is_constructible_v<Error, Arg&&>, "Obscure move constructor.");
+                static_assert(ResultDetails::always_false<Arg>, "Arg converts to both Value and Error, construct one of them explicitly.");
             } else if constexpr (std::is_constructible_v<Value, Arg&&>) {
-                std::construct_at(&_result, static_cast<Value>(arg));
+                std::construct_at(&_value, static_cast<Value>(arg));
+                _has_value = true;
             } else if constexpr (std::is_constructible_v<Error, Arg&&>) {
-                std::construct_at(&_result, static_cast<Error>(arg));
-            } 
+                std::construct_at(&_error, static_cast<Error>(arg));
+                _has_value = false;
+            } else {
+                static_assert(ResultDetails::always_false<Arg>, "Arg converts to neither Value nor Error.");
+            }
         }
 
         template <typename Arg>
-            requires(!std::is_reference_v<Arg>)
+            requires(!std::is_reference_v<Arg> && !std::same_as<Arg, Result>)
         constexpr Result(const Arg& arg) {
             if constexpr (std::same_as<Arg, Value>) {
                 static_assert(Utily::Concepts::HasCopyConstructor<Value>, "Result Value type has no copy constructor");
-                std::construct_at(&_result, arg);
+                std::construct_at(&_value, arg);
+                _has_value = true;
             } else if constexpr (std::same_as<Arg, Error>) {
                 static_assert(Utily::Concepts::HasCopyConstructor<Error>, "Result Error type has no copy constructor");
-                std::construct_at(&_result, arg);
+                std::construct_at(&_error, arg);
+                _has_value = false;
             } else if constexpr (std::is_constructible_v<Value, const Arg&> && std::is_constructible_v<Error, const Arg&>) {
-                static_assert(std::is_constructible_v<Value, const Arg&> && std::is_constructible_v<Error, const Arg&>, "Obscure copy constructor.");
+                static_assert(ResultDetails::always_false<Arg>, "Arg converts to both Value and Error, construct one of them explicitly.");
             } else if constexpr (std::is_constructible_v<Value, const Arg&>) {
-                std::construct_at(&_result, Value{arg});
+                std::construct_at(&_value, Value { arg });
+                _has_value = true;
             } else if constexpr (std::is_constructible_v<Error, const Arg&>) {
-                std::construct_at(&_result, Error{arg});
+                std::construct_at(&_error, Error { arg });
+                _has_value = false;
+            } else {
+                static_assert(ResultDetails::always_false<Arg>, "Arg converts to neither Value nor Error.");
+            }
+        }
+
+        constexpr Result(const Result& other)
+            requires trivially_copyable
+        = default;
+        constexpr Result(const Result& other)
+            requires(!trivially_copyable && std::is_copy_constructible_v<Value> && std::is_copy_constructible_v<Error>)
+        {
+            construct_from(other);
+        }
+
+        constexpr Result(Result&& other)
+            requires trivially_movable
+        = default;
+        constexpr Result(Result&& other) noexcept(std::is_nothrow_move_constructible_v<Value> && std::is_nothrow_move_constructible_v<Error>)
+            requires(!trivially_movable)
+        {
+            construct_from(std::move(other));
+        }
+
+        constexpr auto operator=(const Result& other) -> Result&
+            requires trivially_copyable
+        = default;
+        constexpr auto operator=(const Result& other) -> Result&
+            requires(!trivially_copyable && std::is_copy_constructible_v<Value> && std::is_copy_constructible_v<Error>)
+        {
+            if (this != &other) {
+                assign_from(other);
             }
+            return *this;
+        }
+
+        constexpr auto operator=(Result&& other) -> Result&
+            requires trivially_movable
+        = default;
+        constexpr auto operator=(Result&& other) noexcept(std::is_nothrow_move_constructible_v<Value> && std::is_nothrow_move_constructible_v<Error>) -> Result&
+            requires(!trivially_movable)
+        {
+            if (this != &other) {
+                assign_from(std::move(other));
+            }
+            return *this;
+        }
+
+        constexpr ~Result()
+            requires trivially_destructible
+        = default;
+        constexpr ~Result() {
+            destroy();
         }
 
         [[nodiscard]] constexpr bool has_value() const noexcept {
-            return std::holds_alternative<V>(_result);
+            return _has_value;
         }
         [[nodiscard]] constexpr bool has_error() const noexcept {
-            return std::holds_alternative<E>(_result);
+            return !_has_value;
         }
 
-        [[nodiscard]] constexpr auto value() -> Value& {
-            return std::get<V>(_result).value();
+        [[nodiscard]] constexpr auto value() & noexcept -> Value& {
+            assert(_has_value);
+            return _value;
         }
-        [[nodiscard]] constexpr auto value() const -> const Value& {
-            return std::get<V>(_result).value();
+        [[nodiscard]] constexpr auto value() const& noexcept -> const Value& {
+            assert(_has_value);
+            return _value;
         }
-        [[nodiscard]] constexpr auto error() -> Error& {
-            return std::get<E>(_result).value();
+        [[nodiscard]] constexpr auto value() && noexcept -> Value&& {
+            assert(_has_value);
+            return std::move(_value);
         }
-        [[nodiscard]] constexpr auto error() const -> const Error& {
-            return std::get<E>(_result).value();
+        [[nodiscard]] constexpr auto error() & noexcept -> Error& {
+            assert(!_has_value);
+            return _error;
         }
+        [[nodiscard]] constexpr auto error() const& noexcept -> const Error& {
+            assert(!_has_value);
+            return _error;
+        }
+        [[nodiscard]] constexpr auto error() && noexcept -> Error&& {
+            assert(!_has_value);
+            return std::move(_error);
+        }
+
+        template <typename Default>
+        [[nodiscard]] constexpr auto value_or(Default&& fallback) const& -> Value {
+            return _has_value ? _value : static_cast<Value>(std::forward<Default>(fallback));
+        }
+        template <typename Default>
+        [[nodiscard]] constexpr auto value_or(Default&& fallback) && -> Value {
+            return _has_value ? std::move(_value) : static_cast<Value>(std::forward<Default>(fallback));
+        }
+
+        /*
+         * Monadic chaining, as std::expected. and_then/or_else take a function returning a Result,
+         * transform/transform_error one returning a plain value. Called on an rvalue the value or
+         * error is moved into the function or the new Result, never copied.
+         */
+        template <typename F>
+        constexpr auto and_then(F&& f) & { return and_then_impl(*this, std::forward<F>(f)); }
+        template <typename F>
+        constexpr auto and_then(F&& f) const& { return and_then_impl(*this, std::forward<F>(f)); }
+        template <typename F>
+        constexpr auto and_then(F&& f) && { return and_then_impl(std::move(*this), std::forward<F>(f)); }
+
+        template <typename F>
+        constexpr auto transform(F&& f) & { return transform_impl(*this, std::forward<F>(f)); }
+        template <typename F>
+        constexpr auto transform(F&& f) const& { return transform_impl(*this, std::forward<F>(f)); }
+        template <typename F>
+        constexpr auto transform(F&& f) && { return transform_impl(std::move(*this), std::forward<F>(f)); }
+
+        template <typename F>
+        constexpr auto transform_error(F&& f) & { return transform_error_impl(*this, std::forward<F>(f)); }
+        template <typename F>
+        constexpr auto transform_error(F&& f) const& { return transform_error_impl(*this, std::forward<F>(f)); }
+        template <typename F>
+        constexpr auto transform_error(F&& f) && { return transform_error_impl(std::move(*this), std::forward<F>(f)); }
+
+        template <typename F>
+        constexpr auto or_else(F&& f) & { return or_else_impl(*this, std::forward<F>(f)); }
+        template <typename F>
+        constexpr auto or_else(F&& f) const& { return or_else_impl(*this, std::forward<F>(f)); }
+        template <typename F>
+        constexpr auto or_else(F&& f) && { return or_else_impl(std::move(*this), std::forward<F>(f)); }
 
         template <typename Pred>
             requires Utily::Concepts::IsConstCallableWith<Pred, Value>
         constexpr auto on_value(Pred pred) const noexcept -> const Result& {
             if (has_value()) {
-                pred(std::get<V>(_result).value());
+                pred(_value);
             }
             return *this;
         }
@@ -93,7 +357,7 @@ namespace Utily {
             requires Utily::Concepts::IsCallableWith<Pred, Value>
         constexpr auto on_value(Pred pred) noexcept -> Result& {
             if (has_value()) {
-                pred(std::get<V>(_result).value());
+                pred(_value);
             }
             return *this;
         }
@@ -102,7 +366,7 @@ namespace Utily {
             requires Utily::Concepts::IsConstCallableWith<Pred, Error>
         constexpr auto on_error(Pred pred) const noexcept -> const Result& {
             if (has_error()) {
-                pred(std::get<E>(_result).value());
+                pred(_error);
             }
             return *this;
         }
@@ -111,7 +375,7 @@ namespace Utily {
             requires Utily::Concepts::IsCallableWith<Pred, Error>
         constexpr auto on_error(Pred pred) noexcept -> Result& {
             if (has_error()) {
-                pred(std::get<E>(_result).value());
+                pred(_error);
             }
             return *this;
         }
@@ -120,10 +384,10 @@ namespace Utily {
             requires Utily::Concepts::IsCallableWith<ValuePred, Value>
             && Utily::Concepts::IsCallableWith<ErrorPred, Error>
         constexpr auto on_either(ValuePred value_pred, ErrorPred error_pred) -> Result& {
-            if (std::holds_alternative<V>(_result)) {
-                value_pred(std::get<V>(_result).value());
+            if (has_value()) {
+                value_pred(_value);
             } else {
-                error_pred(std::get<E>(_result).value());
+                error_pred(_error);
             }
             return *this;
         }
@@ -132,23 +396,24 @@ namespace Utily {
             requires Utily::Concepts::IsConstCallableWith<ValuePred, Value>
             && Utily::Concepts::IsConstCallableWith<ErrorPred, Error>
         constexpr auto on_either(ValuePred value_pred, ErrorPred error_pred) const noexcept -> const Result& {
-            if (std::holds_alternative<Value>(_result)) {
-                value_pred(std::get<V>(_result).value());
+            if (has_value()) {
+                value_pred(_value);
             } else {
-                error_pred(std::get<E>(_result).value());
+                error_pred(_error);
             }
             return *this;
         }
 
         auto on_error_panic() -> Result& {
-            if(std::holds_alternative<E>(_result)) {
+            if (has_error()) {
                 throw std::runtime_error("Error encountered, panicking.");
             }
             return *this;
         }
 
         auto value_move() -> Value&& {
-            return std::move(std::get<V>(_result).value());
+            assert(_has_value);
+            return std::move(_value);
         }
     };
 
@@ -159,12 +424,61 @@ namespace Utily {
     private:
         std::optional<Error> _result;
 
+        template <typename Self, typename F>
+        constexpr static auto and_then_impl(Self&& self, F&& f) {
+            using Next = std::remove_cvref_t<std::invoke_result_t<F>>;
+            static_assert(ResultDetails::IsResultType<Next>, "and_then needs a function returning a Result.");
+            static_assert(std::same_as<typename Next::error_type, Error>, "and_then can't change the error type, use transform_error.");
+            if (!self._result.has_value()) {
+                return std::invoke(std::forward<F>(f));
+            }
+            return Next { ResultDetails::forward_member<Self>(*self._result) };
+        }
+
+        template <typename Self, typename F>
+        constexpr static auto transform_impl(Self&& self, F&& f) {
+            using NextValue = std::remove_cvref_t<std::invoke_result_t<F>>;
+            using Next = Result<NextValue, Error>;
+            if (!self._result.has_value()) {
+                if constexpr (std::is_void_v<NextValue>) {
+                    std::invoke(std::forward<F>(f));
+                    return Next {};
+                } else {
+                    return Next { std::invoke(std::forward<F>(f)) };
+                }
+            }
+            return Next { ResultDetails::forward_member<Self>(*self._result) };
+        }
+
+        template <typename Self, typename F>
+        constexpr static auto transform_error_impl(Self&& self, F&& f) {
+            using Next = Result<void, std::remove_cvref_t<std::invoke_result_t<F, decltype(ResultDetails::forward_member<Self>(*self._result))>>>;
+            if (!self._result.has_value()) {
+                return Next {};
+            }
+            return Next { std::invoke(std::forward<F>(f), ResultDetails::forward_member<Self>(*self._result)) };
+        }
+
+        template <typename Self, typename F>
+        constexpr static auto or_else_impl(Self&& self, F&& f) {
+            using Next = std::remove_cvref_t<std::invoke_result_t<F, decltype(ResultDetails::forward_member<Self>(*self._result))>>;
+            static_assert(ResultDetails::IsResultType<Next>, "or_else needs a function returning a Result.");
+            static_assert(std::is_void_v<typename Next::value_type>, "or_else can't change the value type, use transform.");
+            if (!self._result.has_value()) {
+                return Next {};
+            }
+            return std::invoke(std::forward<F>(f), ResultDetails::forward_member<Self>(*self._result));
+        }
+
     public:
+        using value_type = void;
+        using error_type = Error;
+
         constexpr Result()
             : _result(std::nullopt) { }
 
         template <typename Arg>
-            requires(!std::is_reference_v<Arg>)
+            requires(!std::is_reference_v<Arg> && !std::same_as<Arg, Result>)
         constexpr Result(const Arg& arg) {
             if constexpr (std::same_as<Arg, Error>) {
                 static_assert(Utily::Concepts::HasCopyConstructor<Error>, "Result Error type has no copy constructor");
@@ -175,7 +489,7 @@ namespace Utily {
         }
 
         template <typename Arg>
-            requires(!std::is_reference_v<Arg>)
+            requires(!std::is_reference_v<Arg> && !std::same_as<Arg, Result>)
         constexpr Result(Arg&& arg) {
             if constexpr (std::same_as<Arg, Error>) {
                 static_assert(Utily::Concepts::HasMoveConstructor<Error>, "Result Error type has no move constructor");
@@ -192,12 +506,46 @@ namespace Utily {
             return _result.has_value();
         }
 
-        [[nodiscard]] constexpr auto error() -> Error& {
-            return _result.value();
+        [[nodiscard]] constexpr auto error() & noexcept -> Error& {
+            assert(_result.has_value());
+            return *_result;
         }
-        [[nodiscard]] constexpr auto error() const -> const Error& {
-            return _result.value();
+        [[nodiscard]] constexpr auto error() const& noexcept -> const Error& {
+            assert(_result.has_value());
+            return *_result;
         }
+        [[nodiscard]] constexpr auto error() && noexcept -> Error&& {
+            assert(_result.has_value());
+            return std::move(*_result);
+        }
+
+        template <typename F>
+        constexpr auto and_then(F&& f) & { return and_then_impl(*this, std::forward<F>(f)); }
+        template <typename F>
+        constexpr auto and_then(F&& f) const& { return and_then_impl(*this, std::forward<F>(f)); }
+        template <typename F>
+        constexpr auto and_then(F&& f) && { return and_then_impl(std::move(*this), std::forward<F>(f)); }
+
+        template <typename F>
+        constexpr auto transform(F&& f) & { return transform_impl(*this, std::forward<F>(f)); }
+        template <typename F>
+        constexpr auto transform(F&& f) const& { return transform_impl(*this, std::forward<F>(f)); }
+        template <typename F>
+        constexpr auto transform(F&& f) && { return transform_impl(std::move(*this), std::forward<F>(f)); }
+
+        template <typename F>
+        constexpr auto transform_error(F&& f) & { return transform_error_impl(*this, std::forward<F>(f)); }
+        template <typename F>
+        constexpr auto transform_error(F&& f) const& { return transform_error_impl(*this, std::forward<F>(f)); }
+        template <typename F>
+        constexpr auto transform_error(F&& f) && { return transform_error_impl(std::move(*this), std::forward<F>(f)); }
+
+        template <typename F>
+        constexpr auto or_else(F&& f) & { return or_else_impl(*this, std::forward<F>(f)); }
+        template <typename F>
+        constexpr auto or_else(F&& f) const& { return or_else_impl(*this, std::forward<F>(f)); }
+        template <typename F>
+        constexpr auto or_else(F&& f) && { return or_else_impl(std::move(*this), std::forward<F>(f)); }
 
         template <typename Pred>
             requires Utily::Concepts::IsConstCallableWith<Pred, Error>
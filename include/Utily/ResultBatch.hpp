@@ -0,0 +1,127 @@
+#pragma once
+
+#include "Utily/Error.hpp"
+#include "Utily/Result.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace Utily {
+    /*
+     * The outcomes of a bulk operation, in order. Successful values are stored densely, as in a
+     * std::vector<T>, with one bit per outcome recording which succeeded. Errors live in a separate
+     * table alongside the index of the outcome that failed, so a batch with few failures costs
+     * barely more than the values themselves and iterating it is a plain array scan.
+     */
+    template <typename T, typename Error = Utily::Error>
+    class ResultBatch
+    {
+    public:
+        struct IndexedError {
+            size_t index;
+            Error error;
+        };
+
+    private:
+        std::vector<T> _values;
+        std::vector<uint64_t> _success_bits;
+        std::vector<IndexedError> _errors;
+        size_t _size = 0;
+
+        void push_bit(const bool success) {
+            if (_size % 64 == 0) {
+                _success_bits.push_back(0);
+            }
+            _success_bits.back() |= static_cast<uint64_t>(success) << (_size % 64);
+            ++_size;
+        }
+
+    public:
+        void reserve(const size_t size) {
+            _values.reserve(size);
+            _success_bits.reserve((size + 63) / 64);
+        }
+
+        void clear() noexcept {
+            _values.clear();
+            _success_bits.clear();
+            _errors.clear();
+            _size = 0;
+        }
+
+        template <typename... Args>
+        void emplace_back(Args&&... args) {
+            _values.emplace_back(std::forward<Args>(args)...);
+            push_bit(true);
+        }
+        void push_back(const T& value) { emplace_back(value); }
+        void push_back(T&& value) { emplace_back(std::move(value)); }
+
+        void push_error(Error error) {
+            _errors.push_back(IndexedError { _size, std::move(error) });
+            push_bit(false);
+        }
+
+        void push_back(Utily::Result<T, Error>&& result) {
+            if (result.has_value()) {
+                emplace_back(std::move(result).value());
+            } else {
+                push_error(std::move(result).error());
+            }
+        }
+
+        // Number of outcomes, successful or not.
+        [[nodiscard]] auto size() const noexcept -> size_t { return _size; }
+        [[nodiscard]] auto success_count() const noexcept -> size_t { return _values.size(); }
+        [[nodiscard]] auto error_count() const noexcept -> size_t { return _errors.size(); }
+        [[nodiscard]] auto all_succeeded() const noexcept -> bool { return _errors.empty(); }
+
+        [[nodiscard]] auto has_value(const size_t index) const noexcept -> bool {
+            assert(index < _size);
+            return (_success_bits[index / 64] >> (index % 64)) & 1;
+        }
+
+        // The successful values only, in order.
+        [[nodiscard]] auto values() noexcept -> std::span<T> { return _values; }
+        [[nodiscard]] auto values() const noexcept -> std::span<const T> { return _values; }
+        [[nodiscard]] auto errors() const noexcept -> std::span<const IndexedError> { return _errors; }
+
+        [[nodiscard]] auto begin() noexcept { return _values.begin(); }
+        [[nodiscard]] auto begin() const noexcept { return _values.begin(); }
+        [[nodiscard]] auto end() noexcept { return _values.end(); }
+        [[nodiscard]] auto end() const noexcept { return _values.end(); }
+
+        // Calls f(index, value) for each success, index being its position among all outcomes.
+        template <typename F>
+        void for_each_value(F&& f) const {
+            size_t value_index = 0;
+            for (size_t word = 0; word < _success_bits.size(); ++word) {
+                for (uint64_t bits = _success_bits[word]; bits != 0; bits &= bits - 1) {
+                    f(word * 64 + static_cast<size_t>(std::countr_zero(bits)), _values[value_index++]);
+                }
+            }
+        }
+
+        // Outcome by position. Finding a value counts the successes before it, so prefer values() for scans.
+        [[nodiscard]] auto at(const size_t index) const -> Utily::Result<const T*, const Error*> {
+            assert(index < _size);
+            if (!has_value(index)) {
+                const auto error = std::lower_bound(_errors.begin(), _errors.end(), index, [](const IndexedError& e, size_t i) { return e.index < i; });
+                return &error->error;
+            }
+            size_t rank = 0;
+            for (size_t word = 0; word < index / 64; ++word) {
+                rank += static_cast<size_t>(std::popcount(_success_bits[word]));
+            }
+            const uint64_t below = (uint64_t { 1 } << (index % 64)) - 1;
+            rank += static_cast<size_t>(std::popcount(_success_bits[index / 64] & below));
+            return &_values[rank];
+        }
+    };
+}
@@ -0,0 +1,419 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Utily/Error.hpp"
+#include "Utily/Reflection.hpp"
+#include "Utily/Result.hpp"
+#include "Utily/StaticVector.hpp"
+
+namespace Utily::SerializeDetails {
+    static_assert(std::endian::native == std::endian::little, "The wire format is little-endian and is read in place.");
+
+    // Every message starts on this boundary and no value in it needs more.
+    constexpr size_t message_alignment = 16;
+    constexpr uint32_t magic = 0x594C5455; // "UTLY"
+    constexpr uint32_t version = 1;
+    constexpr uint64_t tag = magic | (static_cast<uint64_t>(version) << 32);
+
+    constexpr auto align_up(const size_t offset, const size_t alignment) noexcept -> size_t {
+        return (offset + alignment - 1) & ~(alignment - 1);
+    }
+
+    /*
+     * Containers written as a u64 count then their elements. The owning ones and the views share a
+     * wire format, so a std::vector<T> can be read back as a std::span<const T> without copying.
+     */
+    template <typename T>
+    struct SequenceTraits : std::false_type { };
+    template <typename T, typename Allocator>
+    struct SequenceTraits<std::vector<T, Allocator>> : std::true_type {
+        using element_type = T;
+        constexpr static bool is_view = false;
+    };
+    template <typename T, std::ptrdiff_t S, StaticVectorLayout Layout>
+    struct SequenceTraits<StaticVector<T, S, Layout>> : std::true_type {
+        using element_type = T;
+        constexpr static bool is_view = false;
+        constexpr static size_t capacity = static_cast<size_t>(S);
+    };
+    template <>
+    struct SequenceTraits<std::string> : std::true_type {
+        using element_type = char;
+        constexpr static bool is_view = false;
+    };
+    template <typename T>
+    struct SequenceTraits<std::span<T>> : std::true_type {
+        using element_type = std::remove_const_t<T>;
+        constexpr static bool is_view = std::is_const_v<T>;
+    };
+    template <>
+    struct SequenceTraits<std::string_view> : std::true_type {
+        using element_type = char;
+        constexpr static bool is_view = true;
+    };
+
+    template <typename T>
+    struct IsStdArray : std::false_type { };
+    template <typename T, size_t N>
+    struct IsStdArray<std::array<T, N>> : std::true_type { };
+
+    template <typename T>
+    concept Scalar = std::is_arithmetic_v<T> || std::is_enum_v<T>;
+    template <typename T>
+    concept Sequence = SequenceTraits<T>::value;
+    template <typename T>
+    concept Array = IsStdArray<T>::value;
+    template <typename T>
+    concept Aggregate = std::is_aggregate_v<T> && !std::is_array_v<T> && !Array<T> && !Sequence<T>;
+
+    template <typename T, typename F>
+    constexpr auto all_fields(F f) -> bool {
+        return [&]<size_t... I>(std::index_sequence<I...>) {
+            return (f.template operator()<Reflection::field_type<T, I>>() && ...);
+        }(std::make_index_sequence<Reflection::field_count<T>> {});
+    }
+
+    /*
+     * Flat types are written exactly as they sit in memory (with the padding zeroed), which is the
+     * C layout of their scalars, so an array of them can be read in place.
+     */
+    template <typename T>
+    consteval auto is_flat() -> bool {
+        if constexpr (Scalar<T>) {
+            return true;
+        } else if constexpr (Array<T>) {
+            return is_flat<typename T::value_type>();
+        } else if constexpr (Aggregate<T>) {
+            if constexpr (std::is_trivially_copyable_v<T> && std::is_standard_layout_v<T>) {
+                return all_fields<T>([]<typename Field>() { return is_flat<Field>(); });
+            } else {
+                return false;
+            }
+        } else {
+            return false;
+        }
+    }
+
+    template <typename T>
+    consteval auto unpadded_size() -> size_t {
+        if constexpr (Scalar<T>) {
+            return sizeof(T);
+        } else if constexpr (Array<T>) {
+            return std::tuple_size_v<T> * unpadded_size<typename T::value_type>();
+        } else {
+            return [&]<size_t... I>(std::index_sequence<I...>) {
+                return (size_t { 0 } + ... + unpadded_size<Reflection::field_type<T, I>>());
+            }(std::make_index_sequence<Reflection::field_count<T>> {});
+        }
+    }
+
+    template <typename T>
+    constexpr bool is_flat_v = is_flat<T>();
+
+    template <typename T>
+    constexpr bool has_padding_v = unpadded_size<T>() != sizeof(T);
+
+    // Copies a flat value field by field into zeroed memory, so padding bytes never leak into the output.
+    template <typename T>
+    void write_flat(const T& value, uint8_t* dst) {
+        if constexpr (!has_padding_v<T>) {
+            std::memcpy(dst, &value, sizeof(T));
+        } else if constexpr (Array<T>) {
+            for (size_t i = 0; i < value.size(); ++i) {
+                write_flat(value[i], dst + i * sizeof(typename T::value_type));
+            }
+        } else {
+            const auto fields = Reflection::tie_fields(value);
+            [&]<size_t... I>(std::index_sequence<I...>) {
+                (write_flat(std::get<I>(fields), dst + Reflection::get_field_offset<T, I>()), ...);
+            }(std::make_index_sequence<Reflection::field_count<T>> {});
+        }
+    }
+
+    consteval void add_number(ReflectionDetails::Fnv1a& fnv, size_t number) {
+        std::array<char, 20> digits {};
+        size_t size = 0;
+        do {
+            digits[size++] = static_cast<char>('0' + number % 10);
+            number /= 10;
+        } while (number != 0);
+        while (size > 0) {
+            fnv.add(std::string_view { &digits[--size], 1 });
+        }
+    }
+
+    // Describes the wire format, not the C++ types, so views and owning containers hash the same.
+    template <typename T>
+    consteval void add_schema(ReflectionDetails::Fnv1a& fnv) {
+        if constexpr (std::is_enum_v<T>) {
+            add_schema<std::underlying_type_t<T>>(fnv);
+        } else if constexpr (std::same_as<T, bool>) {
+            fnv.add("b");
+        } else if constexpr (std::same_as<T, char>) {
+            fnv.add("c");
+        } else if constexpr (Scalar<T>) {
+            fnv.add(std::is_floating_point_v<T> ? "f" : std::is_signed_v<T> ? "i" : "u");
+            add_number(fnv, sizeof(T));
+        } else if constexpr (Sequence<T>) {
+            fnv.add("[");
+            add_schema<typename SequenceTraits<T>::element_type>(fnv);
+            fnv.add("]");
+        } else if constexpr (Array<T>) {
+            fnv.add("<");
+            add_number(fnv, std::tuple_size_v<T>);
+            add_schema<typename T::value_type>(fnv);
+            fnv.add(">");
+        } else if constexpr (Aggregate<T>) {
+            fnv.add("{");
+            [&]<size_t... I>(std::index_sequence<I...>) consteval {
+                ((fnv.add(Reflection::get_field_name<T, I>()), fnv.add(":"), add_schema<Reflection::field_type<T, I>>(fnv), fnv.add(";")), ...);
+            }(std::make_index_sequence<Reflection::field_count<T>> {});
+            fnv.add("}");
+        } else {
+            static_assert(Aggregate<T>, "Serialisable types are scalars, enums, std::array, std::vector, StaticVector, std::string, std::span, std::string_view and aggregates of them.");
+        }
+    }
+
+    template <typename T>
+    consteval auto schema_hash() -> uint64_t {
+        ReflectionDetails::Fnv1a fnv;
+        add_schema<T>(fnv);
+        return fnv.hash;
+    }
+
+    class Writer
+    {
+        std::vector<uint8_t>& _out;
+        size_t _start;
+
+        void append(const void* data, const size_t size) {
+            const auto bytes = static_cast<const uint8_t*>(data);
+            _out.insert(_out.end(), bytes, bytes + size);
+        }
+
+        auto append_zeroed(const size_t size) -> uint8_t* {
+            const size_t offset = _out.size();
+            _out.resize(offset + size);
+            return _out.data() + offset;
+        }
+
+        void align(const size_t alignment) {
+            _out.resize(_start + align_up(_out.size() - _start, alignment));
+        }
+
+        template <typename T>
+        void write_flat_range(const T* values, const size_t count) {
+            align(alignof(T));
+            if constexpr (!has_padding_v<T>) {
+                append(values, count * sizeof(T));
+            } else {
+                uint8_t* dst = append_zeroed(count * sizeof(T));
+                for (size_t i = 0; i < count; ++i) {
+                    write_flat(values[i], dst + i * sizeof(T));
+                }
+            }
+        }
+
+    public:
+        explicit Writer(std::vector<uint8_t>& out)
+            : _out(out)
+            , _start(align_up(out.size(), message_alignment)) {
+            _out.resize(_start);
+        }
+
+        template <typename T>
+        void write(const T& value) {
+            static_assert(alignof(T) <= message_alignment, "Over-aligned types can't be serialised.");
+            if constexpr (is_flat_v<T>) {
+                write_flat_range(&value, 1);
+            } else if constexpr (Sequence<T>) {
+                using Element = typename SequenceTraits<T>::element_type;
+                const uint64_t count = std::size(value);
+                align(alignof(uint64_t));
+                append(&count, sizeof(count));
+                if constexpr (is_flat_v<Element>) {
+                    write_flat_range(std::data(value), std::size(value));
+                } else {
+                    for (const auto& element : value) {
+                        write(element);
+                    }
+                }
+            } else if constexpr (Array<T>) {
+                for (const auto& element : value) {
+                    write(element);
+                }
+            } else {
+                static_assert(Aggregate<T>, "Serialisable types are scalars, enums, std::array, std::vector, StaticVector, std::string, std::span, std::string_view and aggregates of them.");
+                Reflection::for_each_field(value, [&](const auto& field) { write(field); });
+            }
+        }
+    };
+
+    class Reader
+    {
+        std::span<const uint8_t> _bytes;
+        size_t _offset = 0;
+
+        void align(const size_t alignment) noexcept {
+            _offset = align_up(_offset, alignment);
+        }
+
+        auto take(const size_t size) noexcept -> Utily::Result<const uint8_t*, Utily::Error> {
+            const size_t available = _offset < _bytes.size() ? _bytes.size() - _offset : 0;
+            if (size > available) {
+                return Utily::Error { Utily::Error::Code::serialized_truncated, _offset, size, available };
+            }
+            const uint8_t* data = _bytes.data() + _offset;
+            _offset += size;
+            return data;
+        }
+
+        template <typename T>
+        auto take_flat_range(const uint64_t count) noexcept -> Utily::Result<const uint8_t*, Utily::Error> {
+            align(alignof(T));
+            constexpr uint64_t max_count = std::numeric_limits<uint64_t>::max() / sizeof(T);
+            return take(count > max_count ? std::numeric_limits<uint64_t>::max() : count * sizeof(T));
+        }
+
+    public:
+        explicit Reader(const std::span<const uint8_t> bytes) noexcept
+            : _bytes(bytes) { }
+
+        template <typename T>
+        auto read(T& out) -> Utily::Result<void, Utily::Error> {
+            if constexpr (is_flat_v<T>) {
+                align(alignof(T));
+                auto data = take(sizeof(T));
+                if (data.has_error()) {
+                    return data.error();
+                }
+                std::memcpy(&out, data.value(), sizeof(T));
+                return {};
+            } else if constexpr (Sequence<T>) {
+                using Traits = SequenceTraits<T>;
+                using Element = typename Traits::element_type;
+
+                uint64_t count = 0;
+                if (auto result = read(count); result.has_error()) {
+                    return result;
+                }
+
+                if constexpr (Traits::is_view) {
+                    static_assert(is_flat_v<Element>, "Only arrays of flat types can be read in place.");
+                    const size_t offset = align_up(_offset, alignof(Element));
+                    auto data = take_flat_range<Element>(count);
+                    if (data.has_error()) {
+                        return data.error();
+                    }
+                    if (reinterpret_cast<std::uintptr_t>(data.value()) % alignof(Element) != 0) {
+                        return Utily::Error { Utily::Error::Code::serialized_misaligned, offset, alignof(Element) };
+                    }
+                    out = T { reinterpret_cast<const Element*>(data.value()), count };
+                    return {};
+                } else {
+                    static_assert(requires { out.resize(0); }, "Spans are read in place, use std::span<const T>.");
+                    if constexpr (requires { Traits::capacity; }) {
+                        if (count > Traits::capacity) {
+                            return Utily::Error { Utily::Error::Code::serialized_too_large, _offset, count, Traits::capacity };
+                        }
+                    }
+                    if constexpr (is_flat_v<Element>) {
+                        auto data = take_flat_range<Element>(count);
+                        if (data.has_error()) {
+                            return data.error();
+                        }
+                        if constexpr (requires { Traits::capacity; }) {
+                            out.resize(static_cast<int>(count));
+                        } else {
+                            out.resize(count);
+                        }
+                        std::memcpy(std::data(out), data.value(), count * sizeof(Element));
+                        return {};
+                    } else {
+                        out.clear();
+                        for (uint64_t i = 0; i < count; ++i) {
+                            Element element {};
+                            if (auto result = read(element); result.has_error()) {
+                                return result;
+                            }
+                            out.push_back(std::move(element));
+                        }
+                        return {};
+                    }
+                }
+            } else if constexpr (Array<T>) {
+                for (auto& element : out) {
+                    if (auto result = read(element); result.has_error()) {
+                        return result;
+                    }
+                }
+                return {};
+            } else {
+                static_assert(Aggregate<T>, "Serialisable types are scalars, enums, std::array, std::vector, StaticVector, std::string, std::span, std::string_view and aggregates of them.");
+                Utily::Result<void, Utily::Error> result {};
+                auto fields = Reflection::tie_fields(out);
+                [&]<size_t... I>(std::index_sequence<I...>) {
+                    static_cast<void>(((result = read(std::get<I>(fields))).has_value() && ...));
+                }(std::make_index_sequence<Reflection::field_count<T>> {});
+                return result;
+            }
+        }
+    };
+}
+
+namespace Utily {
+    /*
+     * Appends obj to out in a flat, little-endian format: a 16 byte header (magic, version and a hash
+     * of T's shape and field names), then every value at its natural alignment, containers as a u64
+     * count followed by their elements. Structs of scalars are written as laid out in memory, so
+     * arrays of them are one copy out and can be read back in place.
+     */
+    template <typename T>
+    void serialize(const T& obj, std::vector<uint8_t>& out) {
+        SerializeDetails::Writer writer { out };
+        const std::array<uint64_t, 2> header = { SerializeDetails::tag, SerializeDetails::schema_hash<T>() };
+        writer.write(header);
+        writer.write(obj);
+    }
+
+    /*
+     * Reads back what serialize wrote, checking the header and every size against bytes. Owning
+     * containers copy, while std::span<const T> and std::string_view members point straight into
+     * bytes (e.g. a FileReader buffer or a mapped file), which must outlive them and start on a 16 byte
+     * boundary. A struct of views can read a struct of vectors and strings, their schemas are equal.
+     * Sizes are checked but values are not: flat data is copied as is, so a bool that isn't 0 or 1 or
+     * an enum outside its enumerators is read as such. Only deserialize bytes from a trusted source.
+     */
+    template <typename T>
+    [[nodiscard]] auto deserialize(const std::span<const uint8_t> bytes) -> Utily::Result<T, Utily::Error> {
+        SerializeDetails::Reader reader { bytes };
+        std::array<uint64_t, 2> header {};
+        if (auto result = reader.read(header); result.has_error()) {
+            return result.error();
+        }
+        if (header[0] != SerializeDetails::tag) {
+            return Utily::Error { Utily::Error::Code::serialized_mismatch, SerializeDetails::tag, header[0] };
+        }
+        if (header[1] != SerializeDetails::schema_hash<T>()) {
+            return Utily::Error { Utily::Error::Code::serialized_mismatch, SerializeDetails::schema_hash<T>(), header[1] };
+        }
+
+        T obj {};
+        if (auto result = reader.read(obj); result.has_error()) {
+            return result.error();
+        }
+        return obj;
+    }
+}
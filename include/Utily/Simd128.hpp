@@ -6,15 +6,23 @@
 #include <bitset>
 #include <cassert>
 #include <concepts>
+#include <cmath>
 #include <cstring>
 #include <iostream>
+#include <limits>
+#include <numeric>
 #include <ranges>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 
 #include <emmintrin.h> // SSE2
 #include <pmmintrin.h> // SSE3
 #include <smmintrin.h> // SSE4.1
+#if defined(__SSE4_2__)
+#include <nmmintrin.h> // SSE4.2
+#endif
+#include <tmmintrin.h> // SSSE3
 #include <xmmintrin.h> // SSE
 
 #ifndef UTY_ALWAYS_INLINE
@@ -96,11 +104,95 @@ namespace Utily::Simd128::Char {
         return static_cast<std::ptrdiff_t>(max_i_clamped) + std::countr_zero(eq_bits);
     }
 
+    /*
+        A set of any bytes, tested in constant time per vector with two nibble lookups (PSHUFB).
+        The low nibble selects a byte from the table matching the high bit, that byte holds one bit
+        for each of the remaining 3 high nibble bits. Build it once and reuse it for every search.
+    */
+    class CharSet
+    {
+        __m128i _high_clear;
+        __m128i _high_set;
+
+    public:
+        CharSet(const char* val_begin, const size_t val_size) noexcept {
+            alignas(16) uint8_t high_clear[16] = {};
+            alignas(16) uint8_t high_set[16] = {};
+            for (size_t i = 0; i < val_size; ++i) {
+                const auto c = static_cast<uint8_t>(val_begin[i]);
+                const auto bit = static_cast<uint8_t>(1u << ((c >> 4) & 0x7));
+                if (c & 0x80) {
+                    high_set[c & 0xF] |= bit;
+                } else {
+                    high_clear[c & 0xF] |= bit;
+                }
+            }
+            _high_clear = _mm_load_si128(reinterpret_cast<const __m128i*>(high_clear));
+            _high_set = _mm_load_si128(reinterpret_cast<const __m128i*>(high_set));
+        }
+
+        explicit CharSet(std::string_view vals) noexcept
+            : CharSet(vals.data(), vals.size()) { }
+
+        // 0xFF in every lane whose byte is in the set.
+        [[nodiscard]] UTY_ALWAYS_INLINE auto matches(const __m128i c) const noexcept -> __m128i {
+            const __m128i bit_lut = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+
+            // PSHUFB zeroes lanes with the high bit set, so each table only answers for its half.
+            const __m128i lo_bits = _mm_or_si128(
+                _mm_shuffle_epi8(_high_clear, c),
+                _mm_shuffle_epi8(_high_set, _mm_xor_si128(c, _mm_set1_epi8(-128))));
+            const __m128i hi_nibble = _mm_and_si128(_mm_srli_epi16(c, 4), _mm_set1_epi8(0x0F));
+            const __m128i hi_bit = _mm_shuffle_epi8(bit_lut, hi_nibble);
+            return _mm_cmpeq_epi8(_mm_and_si128(lo_bits, hi_bit), hi_bit);
+        }
+
+        [[nodiscard]] auto contains(const char c) const noexcept -> bool {
+            return _mm_movemask_epi8(matches(_mm_set1_epi8(c))) != 0;
+        }
+    };
+
+    UTY_ALWAYS_INLINE auto find_first_of(const char* src_begin, const size_t src_size, const CharSet& set) noexcept -> std::ptrdiff_t {
+        constexpr static size_t chars_per_vec = 128 / 8;
+
+        const size_t max_i_clamped = src_size - (src_size % chars_per_vec);
+        const size_t max_2_i_count = src_size - (src_size % (chars_per_vec * 2));
+
+        for (size_t i = 0; i < max_2_i_count; i += chars_per_vec * 2) {
+            const __m128i c0 = _mm_lddqu_si128(reinterpret_cast<const __m128i*>(src_begin + i));
+            const __m128i c1 = _mm_lddqu_si128(reinterpret_cast<const __m128i*>(src_begin + i + chars_per_vec));
+            const uint32_t eq_bits = std::bit_cast<uint32_t>(_mm_movemask_epi8(set.matches(c0)))
+                | (std::bit_cast<uint32_t>(_mm_movemask_epi8(set.matches(c1))) << chars_per_vec);
+            if (eq_bits != 0) {
+                return static_cast<std::ptrdiff_t>(i) + std::countr_zero(eq_bits);
+            }
+        }
+        for (size_t i = max_2_i_count; i < max_i_clamped; i += chars_per_vec) {
+            const __m128i c = _mm_lddqu_si128(reinterpret_cast<const __m128i*>(src_begin + i));
+            const uint32_t eq_bits = std::bit_cast<uint32_t>(_mm_movemask_epi8(set.matches(c)));
+            if (eq_bits != 0) {
+                return static_cast<std::ptrdiff_t>(i) + std::countr_zero(eq_bits);
+            }
+        }
+
+        const size_t remaining = src_size - max_i_clamped;
+        __m128i c = _mm_setzero_si128();
+        memcpy(reinterpret_cast<void*>(&c), (src_begin + max_i_clamped), remaining);
+        // the padding may be in the set, so mark the end of the source as a match.
+        const uint32_t eq_bits = (std::bit_cast<uint32_t>(_mm_movemask_epi8(set.matches(c))) & ((1u << remaining) - 1)) | (1u << remaining);
+        return static_cast<std::ptrdiff_t>(max_i_clamped) + std::countr_zero(eq_bits);
+    }
+
     UTY_ALWAYS_INLINE auto find_first_of(const char* src_begin, const size_t src_size, const char* val_begin, const size_t val_size) noexcept -> std::ptrdiff_t {
         constexpr static size_t chars_per_vec = 128 / 8;
-        constexpr static size_t max_values = 16;
+        // Past this many values the constant time CharSet lookup beats a compare per value.
+        constexpr static size_t max_values = 3;
 
-        assert(val_size < max_values && "Exceeded values capacity, change Utily/Simd.cpp max_values for more.");
+        if (val_size == 0) {
+            return static_cast<std::ptrdiff_t>(src_size);
+        } else if (val_size > max_values) {
+            return find_first_of(src_begin, src_size, CharSet { val_begin, val_size });
+        }
 
         const size_t max_i_clamped = src_size - (src_size % chars_per_vec);
 
@@ -184,11 +276,48 @@ namespace Utily::Simd128::Char {
         return static_cast<std::ptrdiff_t>(max_i_clamped) + std::countr_zero(eq_bits);
     }
 
+    /*
+        Any needle length >= 2. Compares the needle's first and last bytes against two offset loads,
+        only positions where both match are checked with a memcmp of the middle bytes.
+    */
+    UTY_ALWAYS_INLINE auto search_first_last(const char* src_begin, const size_t src_size, const char* val_begin, const size_t val_size) noexcept -> std::ptrdiff_t {
+        constexpr static size_t chars_per_vec = 128 / 8;
+        assert(val_size >= 2);
+
+        if (src_size < val_size) {
+            return static_cast<std::ptrdiff_t>(src_size);
+        }
+
+        const __m128i first = _mm_set1_epi8(val_begin[0]);
+        const __m128i last = _mm_set1_epi8(val_begin[val_size - 1]);
+
+        // Number of starting positions that can be tested with a full vector load at the last byte.
+        const size_t max_i = src_size - val_size + 1;
+        const size_t max_i_clamped = max_i - (max_i % chars_per_vec);
+
+        for (size_t i = 0; i < max_i_clamped; i += chars_per_vec) {
+            const __m128i block_first = _mm_lddqu_si128(reinterpret_cast<const __m128i*>(src_begin + i));
+            const __m128i block_last = _mm_lddqu_si128(reinterpret_cast<const __m128i*>(src_begin + i + val_size - 1));
+
+            uint32_t eq_bits = std::bit_cast<uint32_t>(_mm_movemask_epi8(
+                _mm_and_si128(_mm_cmpeq_epi8(first, block_first), _mm_cmpeq_epi8(last, block_last))));
+
+            while (eq_bits != 0) {
+                const size_t offset = i + static_cast<size_t>(std::countr_zero(eq_bits));
+                if (memcmp(src_begin + offset + 1, val_begin + 1, val_size - 2) == 0) {
+                    return static_cast<std::ptrdiff_t>(offset);
+                }
+                eq_bits &= eq_bits - 1;
+            }
+        }
+        const auto tail = std::search(src_begin + max_i_clamped, src_begin + src_size, val_begin, val_begin + val_size);
+        return std::distance(src_begin, tail);
+    }
+
     template <size_t ValSize>
-    UTY_ALWAYS_INLINE auto search(const char* src_begin [[maybe_unused]], const size_t src_size [[maybe_unused]], const char* val_begin [[maybe_unused]]) noexcept -> std::ptrdiff_t {
-        // static_assert(false, "Not implemented");
-        assert(false && "Not implemeted");
-        return std::ptrdiff_t { 0 };
+    UTY_ALWAYS_INLINE auto search(const char* src_begin, const size_t src_size, const char* val_begin) noexcept -> std::ptrdiff_t {
+        static_assert(ValSize >= 2, "Use find for single characters");
+        return search_first_last(src_begin, src_size, val_begin, ValSize);
     }
     template <>
     UTY_ALWAYS_INLINE auto search<4>(const char* src_begin, const size_t src_size, const char* val_begin) noexcept -> std::ptrdiff_t {
@@ -428,9 +557,1037 @@ namespace Utily::Simd128::Char {
             return Simd128::Char::search<4>(src_begin, src_size, val_begin);
         } else if (val_size == 8) {
             return Simd128::Char::search<8>(src_begin, src_size, val_begin);
+        } else if (val_size == 0) {
+            return 0;
+        }
+        return Simd128::Char::search_first_last(src_begin, src_size, val_begin, val_size);
+    }
+
+    /*
+        Reverse scans walk whole vectors back from the end and take the highest set bit of the compare
+        mask. They return the index of the last match, or -1 when there is none.
+    */
+    UTY_ALWAYS_INLINE auto rfind(const char* src_begin, const size_t src_size, const char val) noexcept -> std::ptrdiff_t {
+        constexpr static size_t chars_per_vec = 128 / 8;
+
+        const __m128i v = _mm_set1_epi8(val);
+        const size_t head = src_size % chars_per_vec;
+
+        size_t i = src_size;
+        for (; i >= head + chars_per_vec * 4; i -= chars_per_vec * 4) {
+            const char* block = src_begin + i - chars_per_vec * 4;
+            const __m128i eq0 = _mm_cmpeq_epi8(_mm_lddqu_si128(reinterpret_cast<const __m128i*>(block + (chars_per_vec * 0))), v);
+            const __m128i eq1 = _mm_cmpeq_epi8(_mm_lddqu_si128(reinterpret_cast<const __m128i*>(block + (chars_per_vec * 1))), v);
+            const __m128i eq2 = _mm_cmpeq_epi8(_mm_lddqu_si128(reinterpret_cast<const __m128i*>(block + (chars_per_vec * 2))), v);
+            const __m128i eq3 = _mm_cmpeq_epi8(_mm_lddqu_si128(reinterpret_cast<const __m128i*>(block + (chars_per_vec * 3))), v);
+
+            if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(eq0, eq1), _mm_or_si128(eq2, eq3))) != 0) {
+                const uint64_t eq_bits = std::bit_cast<uint32_t>(_mm_movemask_epi8(eq0))
+                    | (uint64_t { std::bit_cast<uint32_t>(_mm_movemask_epi8(eq1)) } << (chars_per_vec * 1))
+                    | (uint64_t { std::bit_cast<uint32_t>(_mm_movemask_epi8(eq2)) } << (chars_per_vec * 2))
+                    | (uint64_t { std::bit_cast<uint32_t>(_mm_movemask_epi8(eq3)) } << (chars_per_vec * 3));
+                return static_cast<std::ptrdiff_t>(i - chars_per_vec * 4) + 63 - std::countl_zero(eq_bits);
+            }
+        }
+        for (; i > head; i -= chars_per_vec) {
+            const __m128i c = _mm_lddqu_si128(reinterpret_cast<const __m128i*>(src_begin + i - chars_per_vec));
+            const uint32_t eq_bits = std::bit_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(c, v)));
+            if (eq_bits != 0) {
+                return static_cast<std::ptrdiff_t>(i - chars_per_vec) + 31 - std::countl_zero(eq_bits);
+            }
+        }
+
+        __m128i c = _mm_setzero_si128();
+        memcpy(reinterpret_cast<void*>(&c), src_begin, head);
+        // countl_zero(0) == 32, so no match in the head gives -1.
+        const uint32_t eq_bits = std::bit_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(c, v))) & ((1u << head) - 1);
+        return 31 - std::countl_zero(eq_bits);
+    }
+
+    UTY_ALWAYS_INLINE auto find_last_of(const char* src_begin, const size_t src_size, const CharSet& set) noexcept -> std::ptrdiff_t {
+        constexpr static size_t chars_per_vec = 128 / 8;
+
+        const size_t head = src_size % chars_per_vec;
+
+        size_t i = src_size;
+        for (; i >= head + chars_per_vec * 2; i -= chars_per_vec * 2) {
+            const char* block = src_begin + i - chars_per_vec * 2;
+            const __m128i c0 = _mm_lddqu_si128(reinterpret_cast<const __m128i*>(block));
+            const __m128i c1 = _mm_lddqu_si128(reinterpret_cast<const __m128i*>(block + chars_per_vec));
+            const uint32_t eq_bits = std::bit_cast<uint32_t>(_mm_movemask_epi8(set.matches(c0)))
+                | (std::bit_cast<uint32_t>(_mm_movemask_epi8(set.matches(c1))) << chars_per_vec);
+            if (eq_bits != 0) {
+                return static_cast<std::ptrdiff_t>(i - chars_per_vec * 2) + 31 - std::countl_zero(eq_bits);
+            }
+        }
+        for (; i > head; i -= chars_per_vec) {
+            const __m128i c = _mm_lddqu_si128(reinterpret_cast<const __m128i*>(src_begin + i - chars_per_vec));
+            const uint32_t eq_bits = std::bit_cast<uint32_t>(_mm_movemask_epi8(set.matches(c)));
+            if (eq_bits != 0) {
+                return static_cast<std::ptrdiff_t>(i - chars_per_vec) + 31 - std::countl_zero(eq_bits);
+            }
+        }
+
+        __m128i c = _mm_setzero_si128();
+        memcpy(reinterpret_cast<void*>(&c), src_begin, head);
+        const uint32_t eq_bits = std::bit_cast<uint32_t>(_mm_movemask_epi8(set.matches(c))) & ((1u << head) - 1);
+        return 31 - std::countl_zero(eq_bits);
+    }
+
+    UTY_ALWAYS_INLINE auto find_last_of(const char* src_begin, const size_t src_size, const char* val_begin, const size_t val_size) noexcept -> std::ptrdiff_t {
+        if (val_size == 0) {
+            return -1;
+        } else if (val_size == 1) {
+            return rfind(src_begin, src_size, *val_begin);
+        }
+        return find_last_of(src_begin, src_size, CharSet { val_begin, val_size });
+    }
+
+    /*
+        Start of the last occurrence of the needle, or -1. The empty needle matches at src_size,
+        like std::string::rfind.
+    */
+    UTY_ALWAYS_INLINE auto rsearch(const char* src_begin, const size_t src_size, const char* val_begin, const size_t val_size) noexcept -> std::ptrdiff_t {
+        constexpr static size_t chars_per_vec = 128 / 8;
+
+        if (val_size == 0) {
+            return static_cast<std::ptrdiff_t>(src_size);
+        } else if (src_size < val_size) {
+            return -1;
+        } else if (val_size == 1) {
+            return rfind(src_begin, src_size, *val_begin);
+        }
+
+        const __m128i first = _mm_set1_epi8(val_begin[0]);
+        const __m128i last = _mm_set1_epi8(val_begin[val_size - 1]);
+
+        // Starting positions [0, head) are left for the scalar tail.
+        const size_t max_i = src_size - val_size + 1;
+        const size_t head = max_i % chars_per_vec;
+
+        for (size_t i = max_i; i > head; i -= chars_per_vec) {
+            const char* block = src_begin + i - chars_per_vec;
+            const __m128i block_first = _mm_lddqu_si128(reinterpret_cast<const __m128i*>(block));
+            const __m128i block_last = _mm_lddqu_si128(reinterpret_cast<const __m128i*>(block + val_size - 1));
+
+            uint32_t eq_bits = std::bit_cast<uint32_t>(_mm_movemask_epi8(
+                _mm_and_si128(_mm_cmpeq_epi8(first, block_first), _mm_cmpeq_epi8(last, block_last))));
+
+            while (eq_bits != 0) {
+                const auto bit = 31 - std::countl_zero(eq_bits);
+                if (memcmp(block + bit + 1, val_begin + 1, val_size - 2) == 0) {
+                    return static_cast<std::ptrdiff_t>(i - chars_per_vec) + bit;
+                }
+                eq_bits &= ~(1u << bit);
+            }
+        }
+        const char* head_end = src_begin + head + val_size - 1;
+        const auto found = std::find_end(src_begin, head_end, val_begin, val_begin + val_size);
+        return found == head_end ? -1 : std::distance(src_begin, found);
+    }
+
+
+    namespace Details {
+        [[nodiscard]] constexpr auto fold_ascii(const char c) noexcept -> char {
+            return (c >= 'A' && c <= 'Z') ? static_cast<char>(c | 0x20) : c;
+        }
+        [[nodiscard]] constexpr auto is_ascii_alpha(const char c) noexcept -> bool {
+            return fold_ascii(c) >= 'a' && fold_ascii(c) <= 'z';
+        }
+        // Only letters get the 0x20 bit OR-ed in before comparing, every other byte compares exactly.
+        [[nodiscard]] constexpr auto icase_bit(const char c) noexcept -> char {
+            return is_ascii_alpha(c) ? char { 0x20 } : char { 0 };
+        }
+        [[nodiscard]] inline auto equal_icase(const char* lhs, const char* rhs, const size_t size) noexcept -> bool {
+            for (size_t i = 0; i < size; ++i) {
+                if (fold_ascii(lhs[i]) != fold_ascii(rhs[i])) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Index of the first byte whose lane `match` sets to 0xFF, or src_size.
+        template <typename Match>
+        UTY_ALWAYS_INLINE auto find_first_matching(const char* src_begin, const size_t src_size, const Match& match) noexcept -> std::ptrdiff_t {
+            constexpr static size_t chars_per_vec = 128 / 8;
+
+            const size_t max_i_clamped = src_size - (src_size % chars_per_vec);
+            const size_t max_2_i_count = src_size - (src_size % (chars_per_vec * 2));
+
+            for (size_t i = 0; i < max_2_i_count; i += chars_per_vec * 2) {
+                const __m128i c0 = _mm_lddqu_si128(reinterpret_cast<const __m128i*>(src_begin + i));
+                const __m128i c1 = _mm_lddqu_si128(reinterpret_cast<const __m128i*>(src_begin + i + chars_per_vec));
+                const uint32_t eq_bits = std::bit_cast<uint32_t>(_mm_movemask_epi8(match(c0)))
+                    | (std::bit_cast<uint32_t>(_mm_movemask_epi8(match(c1))) << chars_per_vec);
+                if (eq_bits != 0) {
+                    return static_cast<std::ptrdiff_t>(i) + std::countr_zero(eq_bits);
+                }
+            }
+            for (size_t i = max_2_i_count; i < max_i_clamped; i += chars_per_vec) {
+                const __m128i c = _mm_lddqu_si128(reinterpret_cast<const __m128i*>(src_begin + i));
+                const uint32_t eq_bits = std::bit_cast<uint32_t>(_mm_movemask_epi8(match(c)));
+                if (eq_bits != 0) {
+                    return static_cast<std::ptrdiff_t>(i) + std::countr_zero(eq_bits);
+                }
+            }
+
+            const size_t remaining = src_size - max_i_clamped;
+            __m128i c = _mm_setzero_si128();
+            memcpy(reinterpret_cast<void*>(&c), (src_begin + max_i_clamped), remaining);
+            const uint32_t eq_bits = (std::bit_cast<uint32_t>(_mm_movemask_epi8(match(c))) & ((1u << remaining) - 1)) | (1u << remaining);
+            return static_cast<std::ptrdiff_t>(max_i_clamped) + std::countr_zero(eq_bits);
+        }
+    }
+
+    // ASCII case-insensitive, letters match via (c | 0x20) so no lowercase copy of the source is needed.
+    UTY_ALWAYS_INLINE auto find_icase(const char* src_begin, const size_t src_size, const char val) noexcept -> std::ptrdiff_t {
+        const __m128i bit = _mm_set1_epi8(Details::icase_bit(val));
+        const __m128i v = _mm_set1_epi8(Details::fold_ascii(val));
+        return Details::find_first_matching(src_begin, src_size, [&](const __m128i c) {
+            return _mm_cmpeq_epi8(_mm_or_si128(c, bit), v);
+        });
+    }
+
+    // search_first_last with ASCII case folding on the compared bytes.
+    UTY_ALWAYS_INLINE auto search_icase(const char* src_begin, const size_t src_size, const char* val_begin, const size_t val_size) noexcept -> std::ptrdiff_t {
+        constexpr static size_t chars_per_vec = 128 / 8;
+
+        if (src_size < val_size) {
+            return static_cast<std::ptrdiff_t>(src_size);
+        } else if (val_size == 0) {
+            return 0;
+        } else if (val_size == 1) {
+            return find_icase(src_begin, src_size, *val_begin);
+        }
+
+        const __m128i first_bit = _mm_set1_epi8(Details::icase_bit(val_begin[0]));
+        const __m128i first = _mm_set1_epi8(Details::fold_ascii(val_begin[0]));
+        const __m128i last_bit = _mm_set1_epi8(Details::icase_bit(val_begin[val_size - 1]));
+        const __m128i last = _mm_set1_epi8(Details::fold_ascii(val_begin[val_size - 1]));
+
+        const size_t max_i = src_size - val_size + 1;
+        const size_t max_i_clamped = max_i - (max_i % chars_per_vec);
+
+        for (size_t i = 0; i < max_i_clamped; i += chars_per_vec) {
+            const __m128i block_first = _mm_lddqu_si128(reinterpret_cast<const __m128i*>(src_begin + i));
+            const __m128i block_last = _mm_lddqu_si128(reinterpret_cast<const __m128i*>(src_begin + i + val_size - 1));
+
+            uint32_t eq_bits = std::bit_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(
+                _mm_cmpeq_epi8(_mm_or_si128(block_first, first_bit), first),
+                _mm_cmpeq_epi8(_mm_or_si128(block_last, last_bit), last))));
+
+            while (eq_bits != 0) {
+                const size_t offset = i + static_cast<size_t>(std::countr_zero(eq_bits));
+                if (Details::equal_icase(src_begin + offset + 1, val_begin + 1, val_size - 2)) {
+                    return static_cast<std::ptrdiff_t>(offset);
+                }
+                eq_bits &= eq_bits - 1;
+            }
         }
-        assert(false && "not implemented");
-        return std::distance(src_begin, std::search(src_begin, src_begin + src_size, val_begin, val_begin + val_size));
+        for (size_t i = max_i_clamped; i < max_i; ++i) {
+            if (Details::equal_icase(src_begin + i, val_begin, val_size)) {
+                return static_cast<std::ptrdiff_t>(i);
+            }
+        }
+        return static_cast<std::ptrdiff_t>(src_size);
+    }
+
+    // First byte that isn't ' ', '\t', '\n', '\v', '\f' or '\r' (std::isspace in the "C" locale), or src_size.
+    UTY_ALWAYS_INLINE auto find_first_non_whitespace(const char* src_begin, const size_t src_size) noexcept -> std::ptrdiff_t {
+        return Details::find_first_matching(src_begin, src_size, [](const __m128i c) {
+            // '\t' to '\r' are contiguous, signed compares leave bytes >= 0x80 outside the range.
+            const __m128i space = _mm_or_si128(
+                _mm_cmpeq_epi8(c, _mm_set1_epi8(' ')),
+                _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('\t' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('\r' + 1))));
+            return _mm_xor_si128(space, _mm_set1_epi8(-1));
+        });
     }
 
-}
\ No newline at end of file
+    UTY_ALWAYS_INLINE auto find_first_digit(const char* src_begin, const size_t src_size) noexcept -> std::ptrdiff_t {
+        return Details::find_first_matching(src_begin, src_size, [](const __m128i c) {
+            return _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('9' + 1)));
+        });
+    }
+
+    // First byte with the high bit set, or src_size when the source is all ASCII.
+    UTY_ALWAYS_INLINE auto find_first_non_ascii(const char* src_begin, const size_t src_size) noexcept -> std::ptrdiff_t {
+        return Details::find_first_matching(src_begin, src_size, [](const __m128i c) {
+            return _mm_cmplt_epi8(c, _mm_setzero_si128());
+        });
+    }
+}
+
+namespace Utily::Simd128::Details {
+    /*
+        One specialisation per element type, the generic kernels below only use these. Masks come from
+        _mm_movemask_epi8 for every width, so each element owns sizeof(T) bits of the mask.
+    */
+    template <typename T>
+    struct Lanes;
+
+    template <>
+    struct Lanes<uint16_t> {
+        using Vec = __m128i;
+        constexpr static uint16_t lowest = std::numeric_limits<uint16_t>::min();
+        constexpr static uint16_t highest = std::numeric_limits<uint16_t>::max();
+
+        UTY_ALWAYS_INLINE static auto set1(const uint16_t v) noexcept -> Vec { return _mm_set1_epi16(std::bit_cast<int16_t>(v)); }
+        UTY_ALWAYS_INLINE static auto load(const uint16_t* p) noexcept -> Vec { return _mm_lddqu_si128(reinterpret_cast<const __m128i*>(p)); }
+        UTY_ALWAYS_INLINE static void store(uint16_t* p, const Vec v) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+        UTY_ALWAYS_INLINE static auto eq(const Vec a, const Vec b) noexcept -> Vec { return _mm_cmpeq_epi16(a, b); }
+        // unsigned a > b is max(a, b) != b.
+        UTY_ALWAYS_INLINE static auto gt(const Vec a, const Vec b) noexcept -> Vec { return _mm_xor_si128(_mm_cmpeq_epi16(_mm_max_epu16(a, b), b), _mm_set1_epi8(-1)); }
+        UTY_ALWAYS_INLINE static auto min(const Vec a, const Vec b) noexcept -> Vec { return _mm_min_epu16(a, b); }
+        UTY_ALWAYS_INLINE static auto max(const Vec a, const Vec b) noexcept -> Vec { return _mm_max_epu16(a, b); }
+        UTY_ALWAYS_INLINE static auto mask(const Vec v) noexcept -> uint32_t { return std::bit_cast<uint32_t>(_mm_movemask_epi8(v)); }
+    };
+
+    template <>
+    struct Lanes<int32_t> {
+        using Vec = __m128i;
+        constexpr static int32_t lowest = std::numeric_limits<int32_t>::min();
+        constexpr static int32_t highest = std::numeric_limits<int32_t>::max();
+
+        UTY_ALWAYS_INLINE static auto set1(const int32_t v) noexcept -> Vec { return _mm_set1_epi32(v); }
+        UTY_ALWAYS_INLINE static auto load(const int32_t* p) noexcept -> Vec { return _mm_lddqu_si128(reinterpret_cast<const __m128i*>(p)); }
+        UTY_ALWAYS_INLINE static void store(int32_t* p, const Vec v) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+        UTY_ALWAYS_INLINE static auto eq(const Vec a, const Vec b) noexcept -> Vec { return _mm_cmpeq_epi32(a, b); }
+        UTY_ALWAYS_INLINE static auto gt(const Vec a, const Vec b) noexcept -> Vec { return _mm_cmpgt_epi32(a, b); }
+        UTY_ALWAYS_INLINE static auto min(const Vec a, const Vec b) noexcept -> Vec { return _mm_min_epi32(a, b); }
+        UTY_ALWAYS_INLINE static auto max(const Vec a, const Vec b) noexcept -> Vec { return _mm_max_epi32(a, b); }
+        UTY_ALWAYS_INLINE static auto mask(const Vec v) noexcept -> uint32_t { return std::bit_cast<uint32_t>(_mm_movemask_epi8(v)); }
+        // `b` where `m` is set, otherwise `a`.
+        UTY_ALWAYS_INLINE static auto blend(const Vec a, const Vec b, const Vec m) noexcept -> Vec { return _mm_blendv_epi8(a, b, m); }
+        UTY_ALWAYS_INLINE static auto bits(const Vec m) noexcept -> __m128i { return m; }
+    };
+
+    template <>
+    struct Lanes<uint64_t> {
+        using Vec = __m128i;
+        constexpr static uint64_t lowest = std::numeric_limits<uint64_t>::min();
+        constexpr static uint64_t highest = std::numeric_limits<uint64_t>::max();
+
+        UTY_ALWAYS_INLINE static auto set1(const uint64_t v) noexcept -> Vec { return _mm_set1_epi64x(std::bit_cast<int64_t>(v)); }
+        UTY_ALWAYS_INLINE static auto load(const uint64_t* p) noexcept -> Vec { return _mm_lddqu_si128(reinterpret_cast<const __m128i*>(p)); }
+        UTY_ALWAYS_INLINE static void store(uint64_t* p, const Vec v) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+        UTY_ALWAYS_INLINE static auto eq(const Vec a, const Vec b) noexcept -> Vec { return _mm_cmpeq_epi64(a, b); }
+        // Unsigned compare as signed with the sign bits flipped.
+        UTY_ALWAYS_INLINE static auto gt(const Vec a, const Vec b) noexcept -> Vec {
+            const __m128i sign = _mm_set1_epi64x(std::numeric_limits<int64_t>::min());
+            const __m128i sa = _mm_xor_si128(a, sign);
+            const __m128i sb = _mm_xor_si128(b, sign);
+#if defined(__SSE4_2__)
+            return _mm_cmpgt_epi64(sa, sb);
+#else
+            // No 64 bit compare before SSE4.2. The high halves decide with a signed 32 bit compare,
+            // when they tie the borrow of b - a decides on the low halves.
+            const __m128i gt = _mm_or_si128(
+                _mm_cmpgt_epi32(sa, sb),
+                _mm_and_si128(_mm_cmpeq_epi32(sa, sb), _mm_sub_epi64(sb, sa)));
+            return _mm_shuffle_epi32(gt, _MM_SHUFFLE(3, 3, 1, 1));
+#endif
+        }
+        UTY_ALWAYS_INLINE static auto min(const Vec a, const Vec b) noexcept -> Vec { return _mm_blendv_epi8(a, b, gt(a, b)); }
+        UTY_ALWAYS_INLINE static auto max(const Vec a, const Vec b) noexcept -> Vec { return _mm_blendv_epi8(b, a, gt(a, b)); }
+        UTY_ALWAYS_INLINE static auto mask(const Vec v) noexcept -> uint32_t { return std::bit_cast<uint32_t>(_mm_movemask_epi8(v)); }
+    };
+
+    template <>
+    struct Lanes<float> {
+        using Vec = __m128;
+        constexpr static float lowest = -std::numeric_limits<float>::infinity();
+        constexpr static float highest = std::numeric_limits<float>::infinity();
+
+        UTY_ALWAYS_INLINE static auto set1(const float v) noexcept -> Vec { return _mm_set1_ps(v); }
+        UTY_ALWAYS_INLINE static auto load(const float* p) noexcept -> Vec { return _mm_loadu_ps(p); }
+        UTY_ALWAYS_INLINE static void store(float* p, const Vec v) noexcept { _mm_storeu_ps(p, v); }
+        UTY_ALWAYS_INLINE static auto eq(const Vec a, const Vec b) noexcept -> Vec { return _mm_cmpeq_ps(a, b); }
+        UTY_ALWAYS_INLINE static auto gt(const Vec a, const Vec b) noexcept -> Vec { return _mm_cmpgt_ps(a, b); }
+        // MINPS returns the second operand when either is NaN, so NaNs in `a` never reach the accumulator.
+        UTY_ALWAYS_INLINE static auto min(const Vec a, const Vec b) noexcept -> Vec { return _mm_min_ps(a, b); }
+        UTY_ALWAYS_INLINE static auto max(const Vec a, const Vec b) noexcept -> Vec { return _mm_max_ps(a, b); }
+        UTY_ALWAYS_INLINE static auto mask(const Vec v) noexcept -> uint32_t { return std::bit_cast<uint32_t>(_mm_movemask_epi8(_mm_castps_si128(v))); }
+        UTY_ALWAYS_INLINE static auto blend(const Vec a, const Vec b, const Vec m) noexcept -> Vec { return _mm_blendv_ps(a, b, m); }
+        UTY_ALWAYS_INLINE static auto bits(const Vec m) noexcept -> __m128i { return _mm_castps_si128(m); }
+        UTY_ALWAYS_INLINE static auto add(const Vec a, const Vec b) noexcept -> Vec { return _mm_add_ps(a, b); }
+        UTY_ALWAYS_INLINE static auto sub(const Vec a, const Vec b) noexcept -> Vec { return _mm_sub_ps(a, b); }
+    };
+
+    template <>
+    struct Lanes<double> {
+        using Vec = __m128d;
+        constexpr static double lowest = -std::numeric_limits<double>::infinity();
+        constexpr static double highest = std::numeric_limits<double>::infinity();
+
+        UTY_ALWAYS_INLINE static auto set1(const double v) noexcept -> Vec { return _mm_set1_pd(v); }
+        UTY_ALWAYS_INLINE static auto load(const double* p) noexcept -> Vec { return _mm_loadu_pd(p); }
+        UTY_ALWAYS_INLINE static void store(double* p, const Vec v) noexcept { _mm_storeu_pd(p, v); }
+        UTY_ALWAYS_INLINE static auto eq(const Vec a, const Vec b) noexcept -> Vec { return _mm_cmpeq_pd(a, b); }
+        UTY_ALWAYS_INLINE static auto gt(const Vec a, const Vec b) noexcept -> Vec { return _mm_cmpgt_pd(a, b); }
+        UTY_ALWAYS_INLINE static auto min(const Vec a, const Vec b) noexcept -> Vec { return _mm_min_pd(a, b); }
+        UTY_ALWAYS_INLINE static auto max(const Vec a, const Vec b) noexcept -> Vec { return _mm_max_pd(a, b); }
+        UTY_ALWAYS_INLINE static auto mask(const Vec v) noexcept -> uint32_t { return std::bit_cast<uint32_t>(_mm_movemask_epi8(_mm_castpd_si128(v))); }
+        UTY_ALWAYS_INLINE static auto blend(const Vec a, const Vec b, const Vec m) noexcept -> Vec { return _mm_blendv_pd(a, b, m); }
+        UTY_ALWAYS_INLINE static auto bits(const Vec m) noexcept -> __m128i { return _mm_castpd_si128(m); }
+        UTY_ALWAYS_INLINE static auto add(const Vec a, const Vec b) noexcept -> Vec { return _mm_add_pd(a, b); }
+        UTY_ALWAYS_INLINE static auto sub(const Vec a, const Vec b) noexcept -> Vec { return _mm_sub_pd(a, b); }
+    };
+
+    // Element indices for argmin/argmax, one index lane per element lane.
+    template <size_t ElementSize>
+    struct IndexLanes;
+
+    template <>
+    struct IndexLanes<4> {
+        using Index = uint32_t;
+        UTY_ALWAYS_INLINE static auto iota() noexcept -> __m128i { return _mm_setr_epi32(0, 1, 2, 3); }
+        UTY_ALWAYS_INLINE static auto step(const __m128i i) noexcept -> __m128i { return _mm_add_epi32(i, _mm_set1_epi32(4)); }
+    };
+
+    template <>
+    struct IndexLanes<8> {
+        using Index = uint64_t;
+        UTY_ALWAYS_INLINE static auto iota() noexcept -> __m128i { return _mm_set_epi64x(1, 0); }
+        UTY_ALWAYS_INLINE static auto step(const __m128i i) noexcept -> __m128i { return _mm_add_epi64(i, _mm_set1_epi64x(2)); }
+    };
+
+    // Index of the first element where `match(element_vec, value_vec)` is set, or src_size.
+    template <typename T, typename Match>
+    UTY_ALWAYS_INLINE auto find_first_matching(const T* src_begin, const size_t src_size, const T val, const Match& match) noexcept -> std::ptrdiff_t {
+        using L = Lanes<T>;
+        constexpr static size_t per_vec = 16 / sizeof(T);
+
+        const typename L::Vec v = L::set1(val);
+        const size_t max_i_clamped = src_size - (src_size % per_vec);
+
+        for (size_t i = 0; i < max_i_clamped; i += per_vec) {
+            const uint32_t eq_bits = L::mask(match(L::load(src_begin + i), v));
+            if (eq_bits != 0) {
+                return static_cast<std::ptrdiff_t>(i + static_cast<size_t>(std::countr_zero(eq_bits)) / sizeof(T));
+            }
+        }
+
+        const size_t remaining_bytes = (src_size - max_i_clamped) * sizeof(T);
+        typename L::Vec c = v;
+        memcpy(reinterpret_cast<void*>(&c), src_begin + max_i_clamped, remaining_bytes);
+        const uint32_t eq_bits = (L::mask(match(c, v)) & ((1u << remaining_bytes) - 1)) | (1u << remaining_bytes);
+        return static_cast<std::ptrdiff_t>(max_i_clamped + static_cast<size_t>(std::countr_zero(eq_bits)) / sizeof(T));
+    }
+
+    template <typename T>
+    UTY_ALWAYS_INLINE auto find(const T* src_begin, const size_t src_size, const T val) noexcept -> std::ptrdiff_t {
+        return find_first_matching(src_begin, src_size, val, [](auto c, auto v) { return Lanes<T>::eq(c, v); });
+    }
+
+    template <typename T>
+    UTY_ALWAYS_INLINE auto find_if_greater(const T* src_begin, const size_t src_size, const T val) noexcept -> std::ptrdiff_t {
+        return find_first_matching(src_begin, src_size, val, [](auto c, auto v) { return Lanes<T>::gt(c, v); });
+    }
+
+    template <typename T>
+    UTY_ALWAYS_INLINE auto count(const T* src_begin, const size_t src_size, const T val) noexcept -> size_t {
+        using L = Lanes<T>;
+        constexpr static size_t per_vec = 16 / sizeof(T);
+
+        const typename L::Vec v = L::set1(val);
+        const size_t max_i_clamped = src_size - (src_size % per_vec);
+
+        size_t eq_bytes = 0;
+        for (size_t i = 0; i < max_i_clamped; i += per_vec) {
+            eq_bytes += static_cast<size_t>(std::popcount(L::mask(L::eq(L::load(src_begin + i), v))));
+        }
+
+        const size_t remaining_bytes = (src_size - max_i_clamped) * sizeof(T);
+        typename L::Vec c = v;
+        memcpy(reinterpret_cast<void*>(&c), src_begin + max_i_clamped, remaining_bytes);
+        eq_bytes += static_cast<size_t>(std::popcount(L::mask(L::eq(c, v)) & ((1u << remaining_bytes) - 1)));
+        return eq_bytes / sizeof(T);
+    }
+
+    // Lane-wise `reduce` starting from `identity`, the tail is padded with `identity`.
+    template <typename T, typename Reduce>
+    UTY_ALWAYS_INLINE auto reduce_lanes(const T* src_begin, const size_t src_size, const T identity, const Reduce& reduce) noexcept {
+        using L = Lanes<T>;
+        constexpr static size_t per_vec = 16 / sizeof(T);
+
+        const size_t max_i_clamped = src_size - (src_size % per_vec);
+
+        const size_t max_2_i_count = src_size - (src_size % (per_vec * 2));
+
+        // Two accumulators so the reduce latency isn't one long dependency chain.
+        typename L::Vec acc = L::set1(identity);
+        typename L::Vec acc1 = L::set1(identity);
+        for (size_t i = 0; i < max_2_i_count; i += per_vec * 2) {
+            acc = reduce(L::load(src_begin + i), acc);
+            acc1 = reduce(L::load(src_begin + i + per_vec), acc1);
+        }
+        acc = reduce(acc1, acc);
+        for (size_t i = max_2_i_count; i < max_i_clamped; i += per_vec) {
+            acc = reduce(L::load(src_begin + i), acc);
+        }
+        typename L::Vec c = L::set1(identity);
+        memcpy(reinterpret_cast<void*>(&c), src_begin + max_i_clamped, (src_size - max_i_clamped) * sizeof(T));
+        acc = reduce(c, acc);
+
+        std::array<T, per_vec> lanes;
+        L::store(lanes.data(), acc);
+        return lanes;
+    }
+
+    template <typename T>
+    UTY_ALWAYS_INLINE auto min(const T* src_begin, const size_t src_size) noexcept -> T {
+        return std::ranges::min(reduce_lanes(src_begin, src_size, Lanes<T>::highest, [](auto c, auto acc) { return Lanes<T>::min(c, acc); }));
+    }
+
+    template <typename T>
+    UTY_ALWAYS_INLINE auto max(const T* src_begin, const size_t src_size) noexcept -> T {
+        return std::ranges::max(reduce_lanes(src_begin, src_size, Lanes<T>::lowest, [](auto c, auto acc) { return Lanes<T>::max(c, acc); }));
+    }
+
+    template <typename T>
+    UTY_ALWAYS_INLINE auto minmax(const T* src_begin, const size_t src_size) noexcept -> std::ranges::min_max_result<T> {
+        using L = Lanes<T>;
+        constexpr static size_t per_vec = 16 / sizeof(T);
+
+        const size_t max_i_clamped = src_size - (src_size % per_vec);
+
+        typename L::Vec lo = L::set1(L::highest);
+        typename L::Vec hi = L::set1(L::lowest);
+        for (size_t i = 0; i < max_i_clamped; i += per_vec) {
+            const typename L::Vec c = L::load(src_begin + i);
+            lo = L::min(c, lo);
+            hi = L::max(c, hi);
+        }
+        const size_t remaining_bytes = (src_size - max_i_clamped) * sizeof(T);
+        typename L::Vec c_lo = L::set1(L::highest);
+        typename L::Vec c_hi = L::set1(L::lowest);
+        memcpy(reinterpret_cast<void*>(&c_lo), src_begin + max_i_clamped, remaining_bytes);
+        memcpy(reinterpret_cast<void*>(&c_hi), src_begin + max_i_clamped, remaining_bytes);
+        lo = L::min(c_lo, lo);
+        hi = L::max(c_hi, hi);
+
+        std::array<T, per_vec> lo_lanes;
+        std::array<T, per_vec> hi_lanes;
+        L::store(lo_lanes.data(), lo);
+        L::store(hi_lanes.data(), hi);
+        return { std::ranges::min(lo_lanes), std::ranges::max(hi_lanes) };
+    }
+
+    template <std::floating_point T>
+    UTY_ALWAYS_INLINE auto sum_fast(const T* src_begin, const size_t src_size) noexcept -> T {
+        const auto lanes = reduce_lanes(src_begin, src_size, T { 0 }, [](auto c, auto acc) { return Lanes<T>::add(c, acc); });
+        return std::accumulate(lanes.begin(), lanes.end(), T { 0 });
+    }
+
+    // Halves until a block is small enough for sum_fast, the rounding error grows with log(n) instead of n.
+    template <std::floating_point T>
+    inline auto sum_pairwise(const T* src_begin, const size_t src_size) noexcept -> T {
+        constexpr static size_t block_size = 256;
+        if (src_size <= block_size) {
+            return sum_fast(src_begin, src_size);
+        }
+        const size_t half = src_size / 2;
+        return sum_pairwise(src_begin, half) + sum_pairwise(src_begin + half, src_size - half);
+    }
+
+    // Kahan summation in every lane, the lanes are then combined with a scalar Kahan sum.
+    template <std::floating_point T>
+    UTY_ALWAYS_INLINE auto sum_kahan(const T* src_begin, const size_t src_size) noexcept -> T {
+        using L = Lanes<T>;
+        constexpr static size_t per_vec = 16 / sizeof(T);
+
+        const size_t max_i_clamped = src_size - (src_size % per_vec);
+
+        // Two independent sum/compensation pairs, a single pair is bound by the latency of its four adds.
+        typename L::Vec sum[2] = { L::set1(T { 0 }), L::set1(T { 0 }) };
+        typename L::Vec compensation[2] = { L::set1(T { 0 }), L::set1(T { 0 }) };
+        const auto add = [&](const size_t k, const typename L::Vec c) {
+            const typename L::Vec y = L::sub(c, compensation[k]);
+            const typename L::Vec t = L::add(sum[k], y);
+            compensation[k] = L::sub(L::sub(t, sum[k]), y);
+            sum[k] = t;
+        };
+        const size_t max_2_i_count = src_size - (src_size % (per_vec * 2));
+        for (size_t i = 0; i < max_2_i_count; i += per_vec * 2) {
+            add(0, L::load(src_begin + i));
+            add(1, L::load(src_begin + i + per_vec));
+        }
+        for (size_t i = max_2_i_count; i < max_i_clamped; i += per_vec) {
+            add(0, L::load(src_begin + i));
+        }
+        typename L::Vec c = L::set1(T { 0 });
+        memcpy(reinterpret_cast<void*>(&c), src_begin + max_i_clamped, (src_size - max_i_clamped) * sizeof(T));
+        add(1, c);
+
+        std::array<T, per_vec * 4> parts;
+        L::store(parts.data(), sum[0]);
+        L::store(parts.data() + per_vec, sum[1]);
+        L::store(parts.data() + per_vec * 2, compensation[0]);
+        L::store(parts.data() + per_vec * 3, compensation[1]);
+
+        T total = 0;
+        T total_compensation = 0;
+        for (size_t i = 0; i < parts.size(); ++i) {
+            const T y = (i < per_vec * 2 ? parts[i] : -parts[i]) - total_compensation;
+            const T t = total + y;
+            total_compensation = (t - total) - y;
+            total = t;
+        }
+        return total;
+    }
+
+    /*
+        Index of the first smallest (or largest) element. Every lane keeps its best value and the index it
+        came from, and only moves on a strict improvement, so ties keep the earliest index and NaNs never win.
+        Returns src_size when the range is empty or all NaN.
+    */
+    template <bool Largest, typename T>
+    UTY_ALWAYS_INLINE auto arg_extreme(const T* src_begin, const size_t src_size) noexcept -> std::ptrdiff_t {
+        using L = Lanes<T>;
+        using I = IndexLanes<sizeof(T)>;
+        constexpr static size_t per_vec = 16 / sizeof(T);
+        // 32 bit index lanes for 4 byte elements, so very large ranges are walked in chunks.
+        constexpr static size_t chunk_size = std::numeric_limits<typename I::Index>::max() / 2;
+
+        const auto better = [](const typename L::Vec c, const typename L::Vec best) {
+            if constexpr (Largest) {
+                return L::gt(c, best);
+            } else {
+                return L::gt(best, c);
+            }
+        };
+
+        size_t first = 0;
+        if constexpr (std::floating_point<T>) {
+            while (first < src_size && std::isnan(src_begin[first])) {
+                ++first;
+            }
+        }
+        if (first == src_size) {
+            return static_cast<std::ptrdiff_t>(src_size);
+        }
+
+        size_t result = first;
+        for (size_t chunk_begin = first; chunk_begin < src_size; chunk_begin += chunk_size) {
+            const T* chunk = src_begin + chunk_begin;
+            const size_t size = std::min(chunk_size, src_size - chunk_begin);
+            const size_t max_i_clamped = size - (size % per_vec);
+
+            // Lanes start at the best so far, anything that doesn't beat it is never picked below.
+            const typename L::Vec start = L::set1(src_begin[result]);
+            typename L::Vec best = start;
+            __m128i best_index = _mm_setzero_si128();
+            __m128i index = I::iota();
+            const auto update = [&](const typename L::Vec c) {
+                const typename L::Vec m = better(c, best);
+                best = L::blend(best, c, m);
+                best_index = _mm_blendv_epi8(best_index, index, L::bits(m));
+                index = I::step(index);
+            };
+            for (size_t i = 0; i < max_i_clamped; i += per_vec) {
+                update(L::load(chunk + i));
+            }
+            typename L::Vec c = start;
+            memcpy(reinterpret_cast<void*>(&c), chunk + max_i_clamped, (size - max_i_clamped) * sizeof(T));
+            update(c);
+
+            std::array<T, per_vec> values;
+            std::array<typename I::Index, per_vec> indices;
+            L::store(values.data(), best);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(indices.data()), best_index);
+
+            const auto beats = [](const T lhs, const T rhs) { return Largest ? lhs > rhs : lhs < rhs; };
+            constexpr static size_t none = std::numeric_limits<size_t>::max();
+            T best_value = src_begin[result];
+            size_t best_at = none;
+            for (size_t lane = 0; lane < per_vec; ++lane) {
+                if (!beats(values[lane], src_begin[result])) {
+                    continue;
+                }
+                if (best_at == none || beats(values[lane], best_value) || (values[lane] == best_value && indices[lane] < best_at)) {
+                    best_value = values[lane];
+                    best_at = static_cast<size_t>(indices[lane]);
+                }
+            }
+            if (best_at != none) {
+                result = chunk_begin + best_at;
+            }
+        }
+        return static_cast<std::ptrdiff_t>(result);
+    }
+
+    template <typename T>
+    UTY_ALWAYS_INLINE auto argmin(const T* src_begin, const size_t src_size) noexcept -> std::ptrdiff_t {
+        return arg_extreme<false>(src_begin, src_size);
+    }
+
+    template <typename T>
+    UTY_ALWAYS_INLINE auto argmax(const T* src_begin, const size_t src_size) noexcept -> std::ptrdiff_t {
+        return arg_extreme<true>(src_begin, src_size);
+    }
+
+    // int32 sums widen to 64 bit lanes so they can't overflow.
+    UTY_ALWAYS_INLINE auto sum(const int32_t* src_begin, const size_t src_size) noexcept -> int64_t {
+        constexpr static size_t per_vec = 4;
+
+        const size_t max_i_clamped = src_size - (src_size % per_vec);
+
+        __m128i lo = _mm_setzero_si128();
+        __m128i hi = _mm_setzero_si128();
+        for (size_t i = 0; i < max_i_clamped; i += per_vec) {
+            const __m128i c = _mm_lddqu_si128(reinterpret_cast<const __m128i*>(src_begin + i));
+            lo = _mm_add_epi64(lo, _mm_cvtepi32_epi64(c));
+            hi = _mm_add_epi64(hi, _mm_cvtepi32_epi64(_mm_srli_si128(c, 8)));
+        }
+        std::array<int64_t, 2> lanes;
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes.data()), _mm_add_epi64(lo, hi));
+        int64_t total = lanes[0] + lanes[1];
+        for (size_t i = max_i_clamped; i < src_size; ++i) {
+            total += src_begin[i];
+        }
+        return total;
+    }
+}
+
+/*
+    Element-wise kernels for wider types. find and find_if_greater return src_size when nothing matches.
+    min and max of an empty range are the type's highest and lowest value (infinities for floats),
+    NaNs are skipped.
+*/
+
+namespace Utily::Simd128::U16 {
+    UTY_ALWAYS_INLINE auto find(const uint16_t* src_begin, const size_t src_size, const uint16_t val) noexcept -> std::ptrdiff_t {
+        return Details::find(src_begin, src_size, val);
+    }
+    UTY_ALWAYS_INLINE auto count(const uint16_t* src_begin, const size_t src_size, const uint16_t val) noexcept -> size_t {
+        return Details::count(src_begin, src_size, val);
+    }
+    UTY_ALWAYS_INLINE auto find_if_greater(const uint16_t* src_begin, const size_t src_size, const uint16_t val) noexcept -> std::ptrdiff_t {
+        return Details::find_if_greater(src_begin, src_size, val);
+    }
+    UTY_ALWAYS_INLINE auto min(const uint16_t* src_begin, const size_t src_size) noexcept -> uint16_t {
+        return Details::min(src_begin, src_size);
+    }
+    UTY_ALWAYS_INLINE auto max(const uint16_t* src_begin, const size_t src_size) noexcept -> uint16_t {
+        return Details::max(src_begin, src_size);
+    }
+}
+
+namespace Utily::Simd128::I32 {
+    UTY_ALWAYS_INLINE auto find(const int32_t* src_begin, const size_t src_size, const int32_t val) noexcept -> std::ptrdiff_t {
+        return Details::find(src_begin, src_size, val);
+    }
+    UTY_ALWAYS_INLINE auto count(const int32_t* src_begin, const size_t src_size, const int32_t val) noexcept -> size_t {
+        return Details::count(src_begin, src_size, val);
+    }
+    UTY_ALWAYS_INLINE auto find_if_greater(const int32_t* src_begin, const size_t src_size, const int32_t val) noexcept -> std::ptrdiff_t {
+        return Details::find_if_greater(src_begin, src_size, val);
+    }
+    UTY_ALWAYS_INLINE auto min(const int32_t* src_begin, const size_t src_size) noexcept -> int32_t {
+        return Details::min(src_begin, src_size);
+    }
+    UTY_ALWAYS_INLINE auto max(const int32_t* src_begin, const size_t src_size) noexcept -> int32_t {
+        return Details::max(src_begin, src_size);
+    }
+}
+
+namespace Utily::Simd128::U64 {
+    UTY_ALWAYS_INLINE auto find(const uint64_t* src_begin, const size_t src_size, const uint64_t val) noexcept -> std::ptrdiff_t {
+        return Details::find(src_begin, src_size, val);
+    }
+    UTY_ALWAYS_INLINE auto count(const uint64_t* src_begin, const size_t src_size, const uint64_t val) noexcept -> size_t {
+        return Details::count(src_begin, src_size, val);
+    }
+    UTY_ALWAYS_INLINE auto find_if_greater(const uint64_t* src_begin, const size_t src_size, const uint64_t val) noexcept -> std::ptrdiff_t {
+        return Details::find_if_greater(src_begin, src_size, val);
+    }
+    UTY_ALWAYS_INLINE auto min(const uint64_t* src_begin, const size_t src_size) noexcept -> uint64_t {
+        return Details::min(src_begin, src_size);
+    }
+    UTY_ALWAYS_INLINE auto max(const uint64_t* src_begin, const size_t src_size) noexcept -> uint64_t {
+        return Details::max(src_begin, src_size);
+    }
+}
+
+namespace Utily::Simd128::F32 {
+    UTY_ALWAYS_INLINE auto find(const float* src_begin, const size_t src_size, const float val) noexcept -> std::ptrdiff_t {
+        return Details::find(src_begin, src_size, val);
+    }
+    UTY_ALWAYS_INLINE auto count(const float* src_begin, const size_t src_size, const float val) noexcept -> size_t {
+        return Details::count(src_begin, src_size, val);
+    }
+    UTY_ALWAYS_INLINE auto find_if_greater(const float* src_begin, const size_t src_size, const float val) noexcept -> std::ptrdiff_t {
+        return Details::find_if_greater(src_begin, src_size, val);
+    }
+    UTY_ALWAYS_INLINE auto min(const float* src_begin, const size_t src_size) noexcept -> float {
+        return Details::min(src_begin, src_size);
+    }
+    UTY_ALWAYS_INLINE auto max(const float* src_begin, const size_t src_size) noexcept -> float {
+        return Details::max(src_begin, src_size);
+    }
+}
+
+namespace Utily::Simd128::F64 {
+    UTY_ALWAYS_INLINE auto find(const double* src_begin, const size_t src_size, const double val) noexcept -> std::ptrdiff_t {
+        return Details::find(src_begin, src_size, val);
+    }
+    UTY_ALWAYS_INLINE auto count(const double* src_begin, const size_t src_size, const double val) noexcept -> size_t {
+        return Details::count(src_begin, src_size, val);
+    }
+    UTY_ALWAYS_INLINE auto find_if_greater(const double* src_begin, const size_t src_size, const double val) noexcept -> std::ptrdiff_t {
+        return Details::find_if_greater(src_begin, src_size, val);
+    }
+    UTY_ALWAYS_INLINE auto min(const double* src_begin, const size_t src_size) noexcept -> double {
+        return Details::min(src_begin, src_size);
+    }
+    UTY_ALWAYS_INLINE auto max(const double* src_begin, const size_t src_size) noexcept -> double {
+        return Details::max(src_begin, src_size);
+    }
+}
+
+namespace Utily::Simd128 {
+    // How float sums trade speed for rounding error.
+    enum class Summation : uint8_t {
+        fast,     // one running sum per lane.
+        pairwise, // recursive halving, error grows with log(n).
+        kahan     // compensated per lane, slowest and most accurate.
+    };
+}
+
+/*
+    Reductions, argmin and argmax return the index of the first smallest/largest element and src_size
+    for an empty (or all NaN) range. minmax skips NaNs like min and max.
+*/
+namespace Utily::Simd128::I32 {
+    UTY_ALWAYS_INLINE auto minmax(const int32_t* src_begin, const size_t src_size) noexcept -> std::ranges::min_max_result<int32_t> {
+        return Details::minmax(src_begin, src_size);
+    }
+    UTY_ALWAYS_INLINE auto sum(const int32_t* src_begin, const size_t src_size) noexcept -> int64_t {
+        return Details::sum(src_begin, src_size);
+    }
+    UTY_ALWAYS_INLINE auto argmin(const int32_t* src_begin, const size_t src_size) noexcept -> std::ptrdiff_t {
+        return Details::argmin(src_begin, src_size);
+    }
+    UTY_ALWAYS_INLINE auto argmax(const int32_t* src_begin, const size_t src_size) noexcept -> std::ptrdiff_t {
+        return Details::argmax(src_begin, src_size);
+    }
+}
+
+namespace Utily::Simd128::F32 {
+    UTY_ALWAYS_INLINE auto minmax(const float* src_begin, const size_t src_size) noexcept -> std::ranges::min_max_result<float> {
+        return Details::minmax(src_begin, src_size);
+    }
+    UTY_ALWAYS_INLINE auto sum(const float* src_begin, const size_t src_size, const Summation summation = Summation::fast) noexcept -> float {
+        switch (summation) {
+        case Summation::pairwise: return Details::sum_pairwise(src_begin, src_size);
+        case Summation::kahan: return Details::sum_kahan(src_begin, src_size);
+        default: return Details::sum_fast(src_begin, src_size);
+        }
+    }
+    UTY_ALWAYS_INLINE auto argmin(const float* src_begin, const size_t src_size) noexcept -> std::ptrdiff_t {
+        return Details::argmin(src_begin, src_size);
+    }
+    UTY_ALWAYS_INLINE auto argmax(const float* src_begin, const size_t src_size) noexcept -> std::ptrdiff_t {
+        return Details::argmax(src_begin, src_size);
+    }
+}
+
+namespace Utily::Simd128::F64 {
+    UTY_ALWAYS_INLINE auto minmax(const double* src_begin, const size_t src_size) noexcept -> std::ranges::min_max_result<double> {
+        return Details::minmax(src_begin, src_size);
+    }
+    UTY_ALWAYS_INLINE auto sum(const double* src_begin, const size_t src_size, const Summation summation = Summation::fast) noexcept -> double {
+        switch (summation) {
+        case Summation::pairwise: return Details::sum_pairwise(src_begin, src_size);
+        case Summation::kahan: return Details::sum_kahan(src_begin, src_size);
+        default: return Details::sum_fast(src_begin, src_size);
+        }
+    }
+    UTY_ALWAYS_INLINE auto argmin(const double* src_begin, const size_t src_size) noexcept -> std::ptrdiff_t {
+        return Details::argmin(src_begin, src_size);
+    }
+    UTY_ALWAYS_INLINE auto argmax(const double* src_begin, const size_t src_size) noexcept -> std::ptrdiff_t {
+        return Details::argmax(src_begin, src_size);
+    }
+}
+
+namespace Utily::Simd128::Char::Details {
+    // Sequence length implied by a lead byte, 0 for a continuation or a byte that can never start one.
+    constexpr auto utf8_sequence_length(const uint8_t lead) noexcept -> size_t {
+        if (lead < 0x80) {
+            return 1;
+        } else if (lead < 0xC2) {
+            return 0;
+        } else if (lead < 0xE0) {
+            return 2;
+        } else if (lead < 0xF0) {
+            return 3;
+        } else if (lead < 0xF5) {
+            return 4;
+        }
+        return 0;
+    }
+
+    // Start of the first invalid (or truncated) sequence at or after src_begin + offset, or src_size.
+    constexpr auto find_first_invalid_utf8_scalar(const uint8_t* src_begin, const size_t src_size, size_t offset) noexcept -> std::ptrdiff_t {
+        const auto is_continuation = [](const uint8_t c) { return (c & 0xC0) == 0x80; };
+        while (offset < src_size) {
+            const uint8_t lead = src_begin[offset];
+            const size_t length = utf8_sequence_length(lead);
+            if (length == 0 || offset + length > src_size) {
+                return static_cast<std::ptrdiff_t>(offset);
+            }
+            if (length > 1) {
+                const uint8_t second = src_begin[offset + 1];
+                // The second byte's range excludes overlongs (E0, F0), surrogates (ED) and code points above U+10FFFF (F4).
+                const uint8_t lo = lead == 0xE0 ? 0xA0 : lead == 0xF0 ? 0x90 : 0x80;
+                const uint8_t hi = lead == 0xED ? 0x9F : lead == 0xF4 ? 0x8F : 0xBF;
+                if (second < lo || second > hi) {
+                    return static_cast<std::ptrdiff_t>(offset);
+                }
+                for (size_t i = 2; i < length; ++i) {
+                    if (!is_continuation(src_begin[offset + i])) {
+                        return static_cast<std::ptrdiff_t>(offset);
+                    }
+                }
+            }
+            offset += length;
+        }
+        return static_cast<std::ptrdiff_t>(src_size);
+    }
+
+    /*
+        Where to restart a scalar scan so that it sees the sequence `offset` may be in the middle of. That is the
+        last non-continuation byte in the 3 before, an invalid lead there is only caught along with its successor.
+    */
+    constexpr auto utf8_sequence_start(const uint8_t* src_begin, const size_t offset) noexcept -> size_t {
+        for (size_t back = 1; back <= 3 && back <= offset; ++back) {
+            if ((src_begin[offset - back] & 0xC0) != 0x80) {
+                return offset - back;
+            }
+        }
+        return offset;
+    }
+
+    /*
+        The lookup algorithm from "Validating UTF-8 In Less Than One Instruction Per Byte" (Keiser, Lemire).
+        Every byte is classified by the high nibble of itself and the low and high nibbles of the byte before,
+        three pshufb lookups whose AND is non-zero for any error in a two byte window. The 3rd and 4th bytes
+        of longer sequences are checked by requiring exactly the continuations the leads 2 and 3 back demand.
+    */
+    namespace Utf8 {
+        constexpr static uint8_t too_short = 1 << 0;
+        constexpr static uint8_t too_long = 1 << 1;
+        constexpr static uint8_t overlong_3 = 1 << 2;
+        constexpr static uint8_t too_large = 1 << 3;
+        constexpr static uint8_t surrogate = 1 << 4;
+        constexpr static uint8_t overlong_2 = 1 << 5;
+        constexpr static uint8_t too_large_1000 = 1 << 6;
+        constexpr static uint8_t overlong_4 = 1 << 6;
+        constexpr static uint8_t two_conts = 1 << 7;
+        constexpr static uint8_t carry = too_short | too_long | two_conts;
+
+        constexpr static auto byte_1_high = std::to_array<uint8_t>({
+            too_long, too_long, too_long, too_long, too_long, too_long, too_long, too_long,
+            two_conts, two_conts, two_conts, two_conts,
+            too_short | overlong_2,
+            too_short,
+            too_short | overlong_3 | surrogate,
+            too_short | too_large | too_large_1000 | overlong_4,
+        });
+        constexpr static auto byte_1_low = std::to_array<uint8_t>({
+            carry | overlong_3 | overlong_2 | overlong_4,
+            carry | overlong_2,
+            carry,
+            carry,
+            carry | too_large,
+            carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000 | surrogate,
+            carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000,
+        });
+        constexpr static auto byte_2_high = std::to_array<uint8_t>({
+            too_short, too_short, too_short, too_short, too_short, too_short, too_short, too_short,
+            too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 | overlong_4,
+            too_long | overlong_2 | two_conts | overlong_3 | too_large,
+            too_long | overlong_2 | two_conts | surrogate | too_large,
+            too_long | overlong_2 | two_conts | surrogate | too_large,
+            too_short, too_short, too_short, too_short,
+        });
+    }
+
+    UTY_ALWAYS_INLINE auto load_table(const std::array<uint8_t, 16>& table) noexcept -> __m128i {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(table.data()));
+    }
+
+    // Non-zero bytes where `c`, with `prev` the 16 bytes before it, breaks UTF-8.
+    UTY_ALWAYS_INLINE auto utf8_errors(const __m128i c, const __m128i prev) noexcept -> __m128i {
+        const __m128i nibble = _mm_set1_epi8(0x0F);
+        const __m128i prev1 = _mm_alignr_epi8(c, prev, 15);
+        const __m128i special = _mm_and_si128(
+            _mm_and_si128(
+                _mm_shuffle_epi8(load_table(Utf8::byte_1_high), _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble)),
+                _mm_shuffle_epi8(load_table(Utf8::byte_1_low), _mm_and_si128(prev1, nibble))),
+            _mm_shuffle_epi8(load_table(Utf8::byte_2_high), _mm_and_si128(_mm_srli_epi16(c, 4), nibble)));
+
+        const __m128i prev2 = _mm_alignr_epi8(c, prev, 14);
+        const __m128i prev3 = _mm_alignr_epi8(c, prev, 13);
+        const __m128i must_be_continuation = _mm_and_si128(
+            _mm_or_si128(_mm_subs_epu8(prev2, _mm_set1_epi8(0xE0 - 0x80)), _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80)))),
+            _mm_set1_epi8(static_cast<char>(0x80)));
+        return _mm_xor_si128(must_be_continuation, special);
+    }
+
+    // Non-zero when the last 3 bytes of `c` start a sequence that runs into the next block.
+    UTY_ALWAYS_INLINE auto utf8_incomplete(const __m128i c) noexcept -> __m128i {
+        const __m128i max_value = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+            static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+        return _mm_subs_epu8(c, max_value);
+    }
+}
+
+namespace Utily::Simd128::Char {
+    /*
+        Start of the first invalid or truncated UTF-8 sequence, or src_size when the whole source is valid.
+        Overlongs, surrogates and code points past U+10FFFF are invalid. Runs of ASCII are skipped a block at
+        a time and the exact offset comes from a scalar rescan of the block an error was found in.
+    */
+    UTY_ALWAYS_INLINE auto find_first_invalid_utf8(const char* src_begin, const size_t src_size) noexcept -> std::ptrdiff_t {
+        constexpr static size_t block_size = 64;
+        const auto* src = reinterpret_cast<const uint8_t*>(src_begin);
+
+        const size_t max_i_clamped = src_size - (src_size % block_size);
+
+        __m128i prev = _mm_setzero_si128();
+        for (size_t i = 0; i < max_i_clamped; i += block_size) {
+            __m128i c[4];
+            for (size_t k = 0; k < 4; ++k) {
+                c[k] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + k * 16));
+            }
+            const __m128i any = _mm_or_si128(_mm_or_si128(c[0], c[1]), _mm_or_si128(c[2], c[3]));
+            __m128i errors;
+            if (_mm_movemask_epi8(any) == 0) {
+                // Only a sequence left unfinished by the previous block can fail an ASCII block.
+                errors = Details::utf8_incomplete(prev);
+            } else {
+                errors = Details::utf8_errors(c[0], prev);
+                errors = _mm_or_si128(errors, Details::utf8_errors(c[1], c[0]));
+                errors = _mm_or_si128(errors, Details::utf8_errors(c[2], c[1]));
+                errors = _mm_or_si128(errors, Details::utf8_errors(c[3], c[2]));
+            }
+            if (!_mm_testz_si128(errors, errors)) {
+                return Details::find_first_invalid_utf8_scalar(src, src_size, Details::utf8_sequence_start(src, i));
+            }
+            prev = c[3];
+        }
+        return Details::find_first_invalid_utf8_scalar(src, src_size, Details::utf8_sequence_start(src, max_i_clamped));
+    }
+}
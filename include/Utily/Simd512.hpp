@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Utily/Simd128.hpp"
+
 #include <algorithm>
 #include <array>
 #include <bit>
@@ -7,8 +9,12 @@
 #include <cassert>
 #include <concepts>
 #include <cstring>
+#include <cmath>
 #include <iostream>
+#include <limits>
+#include <numeric>
 #include <ranges>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 
@@ -50,11 +56,106 @@ namespace Utily::Simd512::Char {
         return static_cast<std::ptrdiff_t>(max_i_clamped) + std::countr_zero(eq);
     }
 
+    // Same nibble lookup as Simd128::Char::CharSet, with the tables repeated in every 128 bit lane.
+    class CharSet
+    {
+        __m512i _high_clear;
+        __m512i _high_set;
+
+    public:
+        CharSet(const char* val_begin, const size_t val_size) noexcept {
+            alignas(64) uint8_t high_clear[64] = {};
+            alignas(64) uint8_t high_set[64] = {};
+            for (size_t i = 0; i < val_size; ++i) {
+                const auto c = static_cast<uint8_t>(val_begin[i]);
+                const auto bit = static_cast<uint8_t>(1u << ((c >> 4) & 0x7));
+                for (size_t lane = 0; lane < 64; lane += 16) {
+                    if (c & 0x80) {
+                        high_set[lane + (c & 0xF)] |= bit;
+                    } else {
+                        high_clear[lane + (c & 0xF)] |= bit;
+                    }
+                }
+            }
+            _high_clear = _mm512_load_si512(reinterpret_cast<const __m512i*>(high_clear));
+            _high_set = _mm512_load_si512(reinterpret_cast<const __m512i*>(high_set));
+        }
+
+        explicit CharSet(std::string_view vals) noexcept
+            : CharSet(vals.data(), vals.size()) { }
+
+        // One bit per byte that is in the set.
+        [[nodiscard]] UTY_ALWAYS_INLINE auto matches(const __m512i c) const noexcept -> uint64_t {
+            // bytes 1, 2, 4, ..., 128 repeated.
+            const __m512i bit_lut = _mm512_set1_epi64(static_cast<int64_t>(0x8040201008040201));
+
+            const __m512i lo_bits = _mm512_or_si512(
+                _mm512_shuffle_epi8(_high_clear, c),
+                _mm512_shuffle_epi8(_high_set, _mm512_xor_si512(c, _mm512_set1_epi8(-128))));
+            const __m512i hi_nibble = _mm512_and_si512(_mm512_srli_epi16(c, 4), _mm512_set1_epi8(0x0F));
+            const __m512i hi_bit = _mm512_shuffle_epi8(bit_lut, hi_nibble);
+            return _mm512_test_epi8_mask(lo_bits, hi_bit);
+        }
+    };
+
+    UTY_ALWAYS_INLINE auto find_first_of(const char* src_begin, const size_t src_size, const CharSet& set) noexcept -> std::ptrdiff_t {
+        constexpr static size_t chars_per_vec = 512 / 8;
+
+        const size_t max_i_clamped = src_size - (src_size % chars_per_vec);
+
+        for (size_t i = 0; i < max_i_clamped; i += chars_per_vec) {
+            const __m512i c = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(src_begin + i));
+            const uint64_t eq = set.matches(c);
+            if (eq != 0) {
+                return static_cast<std::ptrdiff_t>(i) + std::countr_zero(eq);
+            }
+        }
+
+        const size_t remaining = src_size - max_i_clamped;
+        __m512i c = _mm512_setzero_si512();
+        memcpy(reinterpret_cast<void*>(&c), (src_begin + max_i_clamped), remaining);
+        // the padding may be in the set, so mark the end of the source as a match.
+        const uint64_t eq = (set.matches(c) & ((uint64_t { 1 } << remaining) - 1)) | (uint64_t { 1 } << remaining);
+        return static_cast<std::ptrdiff_t>(max_i_clamped) + std::countr_zero(eq);
+    }
+
+    // See Simd128::Char::search_first_last.
+    UTY_ALWAYS_INLINE auto search_first_last(const char* src_begin, const size_t src_size, const char* val_begin, const size_t val_size) noexcept -> std::ptrdiff_t {
+        constexpr static size_t chars_per_vec = 512 / 8;
+        assert(val_size >= 2);
+
+        if (src_size < val_size) {
+            return static_cast<std::ptrdiff_t>(src_size);
+        }
+
+        const __m512i first = _mm512_set1_epi8(val_begin[0]);
+        const __m512i last = _mm512_set1_epi8(val_begin[val_size - 1]);
+
+        const size_t max_i = src_size - val_size + 1;
+        const size_t max_i_clamped = max_i - (max_i % chars_per_vec);
+
+        for (size_t i = 0; i < max_i_clamped; i += chars_per_vec) {
+            const __m512i block_first = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(src_begin + i));
+            const __m512i block_last = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(src_begin + i + val_size - 1));
+
+            uint64_t eq = _mm512_cmpeq_epi8_mask(first, block_first) & _mm512_cmpeq_epi8_mask(last, block_last);
+
+            while (eq != 0) {
+                const size_t offset = i + static_cast<size_t>(std::countr_zero(eq));
+                if (memcmp(src_begin + offset + 1, val_begin + 1, val_size - 2) == 0) {
+                    return static_cast<std::ptrdiff_t>(offset);
+                }
+                eq &= eq - 1;
+            }
+        }
+        const auto tail = std::search(src_begin + max_i_clamped, src_begin + src_size, val_begin, val_begin + val_size);
+        return std::distance(src_begin, tail);
+    }
+
     template <size_t ValSize>
-    UTY_ALWAYS_INLINE auto search(const char* src_begin [[maybe_unused]], const size_t src_size [[maybe_unused]], const char* val_begin [[maybe_unused]]) noexcept -> std::ptrdiff_t {
-        // static_assert(false, "Not implemented");
-        assert(false && "Not implemeted");
-        return std::ptrdiff_t { 0 };
+    UTY_ALWAYS_INLINE auto search(const char* src_begin, const size_t src_size, const char* val_begin) noexcept -> std::ptrdiff_t {
+        static_assert(ValSize >= 2, "Use find for single characters");
+        return search_first_last(src_begin, src_size, val_begin, ValSize);
     }
     template <>
     UTY_ALWAYS_INLINE auto search<4>(const char* src_begin, const size_t src_size, const char* val_begin) noexcept -> std::ptrdiff_t {
@@ -142,8 +243,622 @@ namespace Utily::Simd512::Char {
             return static_cast<std::ptrdiff_t>(src_size);
         } else if (val_size == 4) {
             return Simd128::Char::search<4>(src_begin, src_size, val_begin);
+        } else if (val_size == 1) {
+            return Simd512::Char::find(src_begin, src_size, *val_begin);
+        } else if (val_size == 0) {
+            return 0;
+        }
+        return Simd512::Char::search_first_last(src_begin, src_size, val_begin, val_size);
+    }
+
+    // See Simd128::Char::rfind, returns -1 when there is no match.
+    UTY_ALWAYS_INLINE auto rfind(const char* src_begin, const size_t src_size, const char val) noexcept -> std::ptrdiff_t {
+        constexpr static size_t chars_per_vec = 512 / 8;
+
+        const __m512i v = _mm512_set1_epi8(val);
+        const size_t head = src_size % chars_per_vec;
+
+        for (size_t i = src_size; i > head; i -= chars_per_vec) {
+            const __m512i c = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(src_begin + i - chars_per_vec));
+            const uint64_t eq = _mm512_cmpeq_epi8_mask(c, v);
+            if (eq != 0) {
+                return static_cast<std::ptrdiff_t>(i - chars_per_vec) + 63 - std::countl_zero(eq);
+            }
+        }
+        __m512i c = _mm512_setzero_si512();
+        memcpy(reinterpret_cast<void*>(&c), src_begin, head);
+        const uint64_t eq = _mm512_cmpeq_epi8_mask(c, v) & ((uint64_t { 1 } << head) - 1);
+        return 63 - std::countl_zero(eq);
+    }
+
+    UTY_ALWAYS_INLINE auto find_last_of(const char* src_begin, const size_t src_size, const CharSet& set) noexcept -> std::ptrdiff_t {
+        constexpr static size_t chars_per_vec = 512 / 8;
+
+        const size_t head = src_size % chars_per_vec;
+
+        for (size_t i = src_size; i > head; i -= chars_per_vec) {
+            const __m512i c = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(src_begin + i - chars_per_vec));
+            const uint64_t eq = set.matches(c);
+            if (eq != 0) {
+                return static_cast<std::ptrdiff_t>(i - chars_per_vec) + 63 - std::countl_zero(eq);
+            }
+        }
+        __m512i c = _mm512_setzero_si512();
+        memcpy(reinterpret_cast<void*>(&c), src_begin, head);
+        const uint64_t eq = set.matches(c) & ((uint64_t { 1 } << head) - 1);
+        return 63 - std::countl_zero(eq);
+    }
+
+    // See Simd128::Char::rsearch.
+    UTY_ALWAYS_INLINE auto rsearch(const char* src_begin, const size_t src_size, const char* val_begin, const size_t val_size) noexcept -> std::ptrdiff_t {
+        constexpr static size_t chars_per_vec = 512 / 8;
+
+        if (val_size == 0) {
+            return static_cast<std::ptrdiff_t>(src_size);
+        } else if (src_size < val_size) {
+            return -1;
+        } else if (val_size == 1) {
+            return rfind(src_begin, src_size, *val_begin);
+        }
+
+        const __m512i first = _mm512_set1_epi8(val_begin[0]);
+        const __m512i last = _mm512_set1_epi8(val_begin[val_size - 1]);
+
+        const size_t max_i = src_size - val_size + 1;
+        const size_t head = max_i % chars_per_vec;
+
+        for (size_t i = max_i; i > head; i -= chars_per_vec) {
+            const char* block = src_begin + i - chars_per_vec;
+            const __m512i block_first = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(block));
+            const __m512i block_last = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(block + val_size - 1));
+
+            uint64_t eq = _mm512_cmpeq_epi8_mask(first, block_first) & _mm512_cmpeq_epi8_mask(last, block_last);
+
+            while (eq != 0) {
+                const auto bit = 63 - std::countl_zero(eq);
+                if (memcmp(block + bit + 1, val_begin + 1, val_size - 2) == 0) {
+                    return static_cast<std::ptrdiff_t>(i - chars_per_vec) + bit;
+                }
+                eq &= ~(uint64_t { 1 } << bit);
+            }
+        }
+        return Simd128::Char::rsearch(src_begin, head + val_size - 1, val_begin, val_size);
+    }
+
+    namespace Details {
+        // See Simd128::Char::Details::find_first_matching, `match` returns one bit per byte.
+        template <typename Match>
+        UTY_ALWAYS_INLINE auto find_first_matching(const char* src_begin, const size_t src_size, const Match& match) noexcept -> std::ptrdiff_t {
+            constexpr static size_t chars_per_vec = 512 / 8;
+
+            const size_t max_i_clamped = src_size - (src_size % chars_per_vec);
+
+            for (size_t i = 0; i < max_i_clamped; i += chars_per_vec) {
+                const __m512i c = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(src_begin + i));
+                const uint64_t eq = match(c);
+                if (eq != 0) {
+                    return static_cast<std::ptrdiff_t>(i) + std::countr_zero(eq);
+                }
+            }
+
+            const size_t remaining = src_size - max_i_clamped;
+            __m512i c = _mm512_setzero_si512();
+            memcpy(reinterpret_cast<void*>(&c), (src_begin + max_i_clamped), remaining);
+            const uint64_t eq = (match(c) & ((uint64_t { 1 } << remaining) - 1)) | (uint64_t { 1 } << remaining);
+            return static_cast<std::ptrdiff_t>(max_i_clamped) + std::countr_zero(eq);
+        }
+    }
+
+    // See Simd128::Char::find_icase.
+    UTY_ALWAYS_INLINE auto find_icase(const char* src_begin, const size_t src_size, const char val) noexcept -> std::ptrdiff_t {
+        const __m512i bit = _mm512_set1_epi8(Simd128::Char::Details::icase_bit(val));
+        const __m512i v = _mm512_set1_epi8(Simd128::Char::Details::fold_ascii(val));
+        return Details::find_first_matching(src_begin, src_size, [&](const __m512i c) -> uint64_t {
+            return _mm512_cmpeq_epi8_mask(_mm512_or_si512(c, bit), v);
+        });
+    }
+
+    // See Simd128::Char::search_icase.
+    UTY_ALWAYS_INLINE auto search_icase(const char* src_begin, const size_t src_size, const char* val_begin, const size_t val_size) noexcept -> std::ptrdiff_t {
+        constexpr static size_t chars_per_vec = 512 / 8;
+
+        if (src_size < val_size) {
+            return static_cast<std::ptrdiff_t>(src_size);
+        } else if (val_size == 0) {
+            return 0;
+        } else if (val_size == 1) {
+            return find_icase(src_begin, src_size, *val_begin);
+        }
+
+        const __m512i first_bit = _mm512_set1_epi8(Simd128::Char::Details::icase_bit(val_begin[0]));
+        const __m512i first = _mm512_set1_epi8(Simd128::Char::Details::fold_ascii(val_begin[0]));
+        const __m512i last_bit = _mm512_set1_epi8(Simd128::Char::Details::icase_bit(val_begin[val_size - 1]));
+        const __m512i last = _mm512_set1_epi8(Simd128::Char::Details::fold_ascii(val_begin[val_size - 1]));
+
+        const size_t max_i = src_size - val_size + 1;
+        const size_t max_i_clamped = max_i - (max_i % chars_per_vec);
+
+        for (size_t i = 0; i < max_i_clamped; i += chars_per_vec) {
+            const __m512i block_first = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(src_begin + i));
+            const __m512i block_last = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(src_begin + i + val_size - 1));
+
+            uint64_t eq = _mm512_cmpeq_epi8_mask(_mm512_or_si512(block_first, first_bit), first)
+                & _mm512_cmpeq_epi8_mask(_mm512_or_si512(block_last, last_bit), last);
+
+            while (eq != 0) {
+                const size_t offset = i + static_cast<size_t>(std::countr_zero(eq));
+                if (Simd128::Char::Details::equal_icase(src_begin + offset + 1, val_begin + 1, val_size - 2)) {
+                    return static_cast<std::ptrdiff_t>(offset);
+                }
+                eq &= eq - 1;
+            }
+        }
+        const auto tail = Simd128::Char::search_icase(src_begin + max_i_clamped, src_size - max_i_clamped, val_begin, val_size);
+        return static_cast<std::ptrdiff_t>(max_i_clamped) + tail;
+    }
+
+    // See Simd128::Char::find_first_non_whitespace.
+    UTY_ALWAYS_INLINE auto find_first_non_whitespace(const char* src_begin, const size_t src_size) noexcept -> std::ptrdiff_t {
+        return Details::find_first_matching(src_begin, src_size, [](const __m512i c) -> uint64_t {
+            const uint64_t space = _mm512_cmpeq_epi8_mask(c, _mm512_set1_epi8(' '))
+                | (_mm512_cmpgt_epi8_mask(c, _mm512_set1_epi8('\t' - 1)) & _mm512_cmplt_epi8_mask(c, _mm512_set1_epi8('\r' + 1)));
+            return ~space;
+        });
+    }
+
+    UTY_ALWAYS_INLINE auto find_first_digit(const char* src_begin, const size_t src_size) noexcept -> std::ptrdiff_t {
+        return Details::find_first_matching(src_begin, src_size, [](const __m512i c) -> uint64_t {
+            return _mm512_cmpgt_epi8_mask(c, _mm512_set1_epi8('0' - 1)) & _mm512_cmplt_epi8_mask(c, _mm512_set1_epi8('9' + 1));
+        });
+    }
+
+    UTY_ALWAYS_INLINE auto find_first_non_ascii(const char* src_begin, const size_t src_size) noexcept -> std::ptrdiff_t {
+        return Details::find_first_matching(src_begin, src_size, [](const __m512i c) -> uint64_t {
+            return _mm512_movepi8_mask(c);
+        });
+    }
+}
+
+namespace Utily::Simd512::Details {
+    // See Simd128::Details::Lanes. Compares give a bit per element, tails use masked loads.
+    template <typename T>
+    struct Lanes;
+
+    template <>
+    struct Lanes<int32_t> {
+        using Vec = __m512i;
+        using Mask = __mmask16;
+        constexpr static int32_t lowest = std::numeric_limits<int32_t>::min();
+        constexpr static int32_t highest = std::numeric_limits<int32_t>::max();
+
+        UTY_ALWAYS_INLINE static auto set1(const int32_t v) noexcept -> Vec { return _mm512_set1_epi32(v); }
+        UTY_ALWAYS_INLINE static auto load(const int32_t* p) noexcept -> Vec { return _mm512_loadu_si512(p); }
+        UTY_ALWAYS_INLINE static auto load(const Vec fill, const Mask m, const int32_t* p) noexcept -> Vec { return _mm512_mask_loadu_epi32(fill, m, p); }
+        UTY_ALWAYS_INLINE static void store(int32_t* p, const Vec v) noexcept { _mm512_storeu_si512(p, v); }
+        UTY_ALWAYS_INLINE static auto gt(const Vec a, const Vec b) noexcept -> Mask { return _mm512_cmpgt_epi32_mask(a, b); }
+        UTY_ALWAYS_INLINE static auto min(const Vec a, const Vec b) noexcept -> Vec { return _mm512_min_epi32(a, b); }
+        UTY_ALWAYS_INLINE static auto max(const Vec a, const Vec b) noexcept -> Vec { return _mm512_max_epi32(a, b); }
+        UTY_ALWAYS_INLINE static auto blend(const Vec a, const Vec b, const Mask m) noexcept -> Vec { return _mm512_mask_blend_epi32(m, a, b); }
+    };
+
+    template <>
+    struct Lanes<float> {
+        using Vec = __m512;
+        using Mask = __mmask16;
+        constexpr static float lowest = -std::numeric_limits<float>::infinity();
+        constexpr static float highest = std::numeric_limits<float>::infinity();
+
+        UTY_ALWAYS_INLINE static auto set1(const float v) noexcept -> Vec { return _mm512_set1_ps(v); }
+        UTY_ALWAYS_INLINE static auto load(const float* p) noexcept -> Vec { return _mm512_loadu_ps(p); }
+        UTY_ALWAYS_INLINE static auto load(const Vec fill, const Mask m, const float* p) noexcept -> Vec { return _mm512_mask_loadu_ps(fill, m, p); }
+        UTY_ALWAYS_INLINE static void store(float* p, const Vec v) noexcept { _mm512_storeu_ps(p, v); }
+        UTY_ALWAYS_INLINE static auto gt(const Vec a, const Vec b) noexcept -> Mask { return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); }
+        UTY_ALWAYS_INLINE static auto min(const Vec a, const Vec b) noexcept -> Vec { return _mm512_min_ps(a, b); }
+        UTY_ALWAYS_INLINE static auto max(const Vec a, const Vec b) noexcept -> Vec { return _mm512_max_ps(a, b); }
+        UTY_ALWAYS_INLINE static auto blend(const Vec a, const Vec b, const Mask m) noexcept -> Vec { return _mm512_mask_blend_ps(m, a, b); }
+        UTY_ALWAYS_INLINE static auto add(const Vec a, const Vec b) noexcept -> Vec { return _mm512_add_ps(a, b); }
+        UTY_ALWAYS_INLINE static auto sub(const Vec a, const Vec b) noexcept -> Vec { return _mm512_sub_ps(a, b); }
+    };
+
+    template <>
+    struct Lanes<double> {
+        using Vec = __m512d;
+        using Mask = __mmask8;
+        constexpr static double lowest = -std::numeric_limits<double>::infinity();
+        constexpr static double highest = std::numeric_limits<double>::infinity();
+
+        UTY_ALWAYS_INLINE static auto set1(const double v) noexcept -> Vec { return _mm512_set1_pd(v); }
+        UTY_ALWAYS_INLINE static auto load(const double* p) noexcept -> Vec { return _mm512_loadu_pd(p); }
+        UTY_ALWAYS_INLINE static auto load(const Vec fill, const Mask m, const double* p) noexcept -> Vec { return _mm512_mask_loadu_pd(fill, m, p); }
+        UTY_ALWAYS_INLINE static void store(double* p, const Vec v) noexcept { _mm512_storeu_pd(p, v); }
+        UTY_ALWAYS_INLINE static auto gt(const Vec a, const Vec b) noexcept -> Mask { return _mm512_cmp_pd_mask(a, b, _CMP_GT_OQ); }
+        UTY_ALWAYS_INLINE static auto min(const Vec a, const Vec b) noexcept -> Vec { return _mm512_min_pd(a, b); }
+        UTY_ALWAYS_INLINE static auto max(const Vec a, const Vec b) noexcept -> Vec { return _mm512_max_pd(a, b); }
+        UTY_ALWAYS_INLINE static auto blend(const Vec a, const Vec b, const Mask m) noexcept -> Vec { return _mm512_mask_blend_pd(m, a, b); }
+        UTY_ALWAYS_INLINE static auto add(const Vec a, const Vec b) noexcept -> Vec { return _mm512_add_pd(a, b); }
+        UTY_ALWAYS_INLINE static auto sub(const Vec a, const Vec b) noexcept -> Vec { return _mm512_sub_pd(a, b); }
+    };
+
+    template <size_t ElementSize>
+    struct IndexLanes;
+
+    template <>
+    struct IndexLanes<4> {
+        using Index = uint32_t;
+        UTY_ALWAYS_INLINE static auto iota() noexcept -> __m512i { return _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15); }
+        UTY_ALWAYS_INLINE static auto step(const __m512i i) noexcept -> __m512i { return _mm512_add_epi32(i, _mm512_set1_epi32(16)); }
+        UTY_ALWAYS_INLINE static auto blend(const __m512i a, const __m512i b, const __mmask16 m) noexcept -> __m512i { return _mm512_mask_blend_epi32(m, a, b); }
+    };
+
+    template <>
+    struct IndexLanes<8> {
+        using Index = uint64_t;
+        UTY_ALWAYS_INLINE static auto iota() noexcept -> __m512i { return _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0); }
+        UTY_ALWAYS_INLINE static auto step(const __m512i i) noexcept -> __m512i { return _mm512_add_epi64(i, _mm512_set1_epi64(8)); }
+        UTY_ALWAYS_INLINE static auto blend(const __m512i a, const __m512i b, const __mmask8 m) noexcept -> __m512i { return _mm512_mask_blend_epi64(m, a, b); }
+    };
+
+    template <typename T>
+    constexpr static size_t per_vec = 64 / sizeof(T);
+
+    template <typename T>
+    UTY_ALWAYS_INLINE auto tail_mask(const size_t remaining) noexcept -> typename Lanes<T>::Mask {
+        return static_cast<typename Lanes<T>::Mask>((uint32_t { 1 } << remaining) - 1);
+    }
+
+    // Lane-wise `reduce` over two accumulators, the tail lanes are filled with `identity`.
+    template <typename T, typename Reduce>
+    UTY_ALWAYS_INLINE auto reduce_lanes(const T* src_begin, const size_t src_size, const T identity, const Reduce& reduce) noexcept {
+        using L = Lanes<T>;
+        constexpr static size_t n = per_vec<T>;
+
+        const size_t max_i_clamped = src_size - (src_size % n);
+        const size_t max_2_i_count = src_size - (src_size % (n * 2));
+
+        typename L::Vec acc = L::set1(identity);
+        typename L::Vec acc1 = L::set1(identity);
+        for (size_t i = 0; i < max_2_i_count; i += n * 2) {
+            acc = reduce(L::load(src_begin + i), acc);
+            acc1 = reduce(L::load(src_begin + i + n), acc1);
+        }
+        acc = reduce(acc1, acc);
+        for (size_t i = max_2_i_count; i < max_i_clamped; i += n) {
+            acc = reduce(L::load(src_begin + i), acc);
+        }
+        acc = reduce(L::load(L::set1(identity), tail_mask<T>(src_size - max_i_clamped), src_begin + max_i_clamped), acc);
+
+        std::array<T, n> lanes;
+        L::store(lanes.data(), acc);
+        return lanes;
+    }
+
+    template <typename T>
+    UTY_ALWAYS_INLINE auto min(const T* src_begin, const size_t src_size) noexcept -> T {
+        return std::ranges::min(reduce_lanes(src_begin, src_size, Lanes<T>::highest, [](auto c, auto acc) { return Lanes<T>::min(c, acc); }));
+    }
+
+    template <typename T>
+    UTY_ALWAYS_INLINE auto max(const T* src_begin, const size_t src_size) noexcept -> T {
+        return std::ranges::max(reduce_lanes(src_begin, src_size, Lanes<T>::lowest, [](auto c, auto acc) { return Lanes<T>::max(c, acc); }));
+    }
+
+    template <typename T>
+    UTY_ALWAYS_INLINE auto minmax(const T* src_begin, const size_t src_size) noexcept -> std::ranges::min_max_result<T> {
+        using L = Lanes<T>;
+        constexpr static size_t n = per_vec<T>;
+
+        const size_t max_i_clamped = src_size - (src_size % n);
+
+        typename L::Vec lo = L::set1(L::highest);
+        typename L::Vec hi = L::set1(L::lowest);
+        for (size_t i = 0; i < max_i_clamped; i += n) {
+            const typename L::Vec c = L::load(src_begin + i);
+            lo = L::min(c, lo);
+            hi = L::max(c, hi);
+        }
+        const auto m = tail_mask<T>(src_size - max_i_clamped);
+        lo = L::min(L::load(L::set1(L::highest), m, src_begin + max_i_clamped), lo);
+        hi = L::max(L::load(L::set1(L::lowest), m, src_begin + max_i_clamped), hi);
+
+        std::array<T, n> lo_lanes;
+        std::array<T, n> hi_lanes;
+        L::store(lo_lanes.data(), lo);
+        L::store(hi_lanes.data(), hi);
+        return { std::ranges::min(lo_lanes), std::ranges::max(hi_lanes) };
+    }
+
+    template <std::floating_point T>
+    UTY_ALWAYS_INLINE auto sum_fast(const T* src_begin, const size_t src_size) noexcept -> T {
+        const auto lanes = reduce_lanes(src_begin, src_size, T { 0 }, [](auto c, auto acc) { return Lanes<T>::add(c, acc); });
+        return std::accumulate(lanes.begin(), lanes.end(), T { 0 });
+    }
+
+    template <std::floating_point T>
+    inline auto sum_pairwise(const T* src_begin, const size_t src_size) noexcept -> T {
+        constexpr static size_t block_size = 1024;
+        if (src_size <= block_size) {
+            return sum_fast(src_begin, src_size);
+        }
+        const size_t half = src_size / 2;
+        return sum_pairwise(src_begin, half) + sum_pairwise(src_begin + half, src_size - half);
+    }
+
+    template <std::floating_point T>
+    UTY_ALWAYS_INLINE auto sum_kahan(const T* src_begin, const size_t src_size) noexcept -> T {
+        using L = Lanes<T>;
+        constexpr static size_t n = per_vec<T>;
+
+        const size_t max_i_clamped = src_size - (src_size % n);
+
+        typename L::Vec sum[2] = { L::set1(T { 0 }), L::set1(T { 0 }) };
+        typename L::Vec compensation[2] = { L::set1(T { 0 }), L::set1(T { 0 }) };
+        const auto add = [&](const size_t k, const typename L::Vec c) {
+            const typename L::Vec y = L::sub(c, compensation[k]);
+            const typename L::Vec t = L::add(sum[k], y);
+            compensation[k] = L::sub(L::sub(t, sum[k]), y);
+            sum[k] = t;
+        };
+        const size_t max_2_i_count = src_size - (src_size % (n * 2));
+        for (size_t i = 0; i < max_2_i_count; i += n * 2) {
+            add(0, L::load(src_begin + i));
+            add(1, L::load(src_begin + i + n));
+        }
+        for (size_t i = max_2_i_count; i < max_i_clamped; i += n) {
+            add(0, L::load(src_begin + i));
+        }
+        add(1, L::load(L::set1(T { 0 }), tail_mask<T>(src_size - max_i_clamped), src_begin + max_i_clamped));
+
+        std::array<T, n * 4> parts;
+        L::store(parts.data(), sum[0]);
+        L::store(parts.data() + n, sum[1]);
+        L::store(parts.data() + n * 2, compensation[0]);
+        L::store(parts.data() + n * 3, compensation[1]);
+
+        T total = 0;
+        T total_compensation = 0;
+        for (size_t i = 0; i < parts.size(); ++i) {
+            const T y = (i < n * 2 ? parts[i] : -parts[i]) - total_compensation;
+            const T t = total + y;
+            total_compensation = (t - total) - y;
+            total = t;
+        }
+        return total;
+    }
+
+    // See Simd128::Details::arg_extreme.
+    template <bool Largest, typename T>
+    UTY_ALWAYS_INLINE auto arg_extreme(const T* src_begin, const size_t src_size) noexcept -> std::ptrdiff_t {
+        using L = Lanes<T>;
+        using I = IndexLanes<sizeof(T)>;
+        constexpr static size_t n = per_vec<T>;
+        constexpr static size_t chunk_size = std::numeric_limits<typename I::Index>::max() / 2;
+
+        const auto better = [](const typename L::Vec c, const typename L::Vec best) {
+            if constexpr (Largest) {
+                return L::gt(c, best);
+            } else {
+                return L::gt(best, c);
+            }
+        };
+
+        size_t first = 0;
+        if constexpr (std::floating_point<T>) {
+            while (first < src_size && std::isnan(src_begin[first])) {
+                ++first;
+            }
+        }
+        if (first == src_size) {
+            return static_cast<std::ptrdiff_t>(src_size);
+        }
+
+        size_t result = first;
+        for (size_t chunk_begin = first; chunk_begin < src_size; chunk_begin += chunk_size) {
+            const T* chunk = src_begin + chunk_begin;
+            const size_t size = std::min(chunk_size, src_size - chunk_begin);
+            const size_t max_i_clamped = size - (size % n);
+
+            const typename L::Vec start = L::set1(src_begin[result]);
+            typename L::Vec best = start;
+            __m512i best_index = _mm512_setzero_si512();
+            __m512i index = I::iota();
+            const auto update = [&](const typename L::Vec c) {
+                const auto m = better(c, best);
+                best = L::blend(best, c, m);
+                best_index = I::blend(best_index, index, m);
+                index = I::step(index);
+            };
+            for (size_t i = 0; i < max_i_clamped; i += n) {
+                update(L::load(chunk + i));
+            }
+            update(L::load(start, tail_mask<T>(size - max_i_clamped), chunk + max_i_clamped));
+
+            std::array<T, n> values;
+            std::array<typename I::Index, n> indices;
+            L::store(values.data(), best);
+            _mm512_storeu_si512(indices.data(), best_index);
+
+            const auto beats = [](const T lhs, const T rhs) { return Largest ? lhs > rhs : lhs < rhs; };
+            constexpr static size_t none = std::numeric_limits<size_t>::max();
+            T best_value = src_begin[result];
+            size_t best_at = none;
+            for (size_t lane = 0; lane < n; ++lane) {
+                if (!beats(values[lane], src_begin[result])) {
+                    continue;
+                }
+                if (best_at == none || beats(values[lane], best_value) || (values[lane] == best_value && indices[lane] < best_at)) {
+                    best_value = values[lane];
+                    best_at = static_cast<size_t>(indices[lane]);
+                }
+            }
+            if (best_at != none) {
+                result = chunk_begin + best_at;
+            }
+        }
+        return static_cast<std::ptrdiff_t>(result);
+    }
+
+    UTY_ALWAYS_INLINE auto sum(const int32_t* src_begin, const size_t src_size) noexcept -> int64_t {
+        constexpr static size_t n = per_vec<int32_t>;
+
+        const size_t max_i_clamped = src_size - (src_size % n);
+
+        const auto add = [](const __m512i c, const __m512i acc) {
+            return _mm512_add_epi64(acc, _mm512_add_epi64(
+                _mm512_cvtepi32_epi64(_mm512_castsi512_si256(c)),
+                _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(c, 1))));
+        };
+        __m512i acc = _mm512_setzero_si512();
+        for (size_t i = 0; i < max_i_clamped; i += n) {
+            acc = add(_mm512_loadu_si512(src_begin + i), acc);
+        }
+        acc = add(_mm512_maskz_loadu_epi32(tail_mask<int32_t>(src_size - max_i_clamped), src_begin + max_i_clamped), acc);
+        return _mm512_reduce_add_epi64(acc);
+    }
+}
+
+namespace Utily::Simd512 {
+    using Summation = Simd128::Summation;
+}
+
+/*
+    See the Simd128 namespaces of the same name. argmin and argmax return src_size for an empty (or all
+    NaN) range, min and max of an empty range are the type's highest and lowest value.
+*/
+namespace Utily::Simd512::I32 {
+    UTY_ALWAYS_INLINE auto min(const int32_t* src_begin, const size_t src_size) noexcept -> int32_t {
+        return Details::min(src_begin, src_size);
+    }
+    UTY_ALWAYS_INLINE auto max(const int32_t* src_begin, const size_t src_size) noexcept -> int32_t {
+        return Details::max(src_begin, src_size);
+    }
+    UTY_ALWAYS_INLINE auto minmax(const int32_t* src_begin, const size_t src_size) noexcept -> std::ranges::min_max_result<int32_t> {
+        return Details::minmax(src_begin, src_size);
+    }
+    UTY_ALWAYS_INLINE auto sum(const int32_t* src_begin, const size_t src_size) noexcept -> int64_t {
+        return Details::sum(src_begin, src_size);
+    }
+    UTY_ALWAYS_INLINE auto argmin(const int32_t* src_begin, const size_t src_size) noexcept -> std::ptrdiff_t {
+        return Details::arg_extreme<false>(src_begin, src_size);
+    }
+    UTY_ALWAYS_INLINE auto argmax(const int32_t* src_begin, const size_t src_size) noexcept -> std::ptrdiff_t {
+        return Details::arg_extreme<true>(src_begin, src_size);
+    }
+}
+
+namespace Utily::Simd512::F32 {
+    UTY_ALWAYS_INLINE auto min(const float* src_begin, const size_t src_size) noexcept -> float {
+        return Details::min(src_begin, src_size);
+    }
+    UTY_ALWAYS_INLINE auto max(const float* src_begin, const size_t src_size) noexcept -> float {
+        return Details::max(src_begin, src_size);
+    }
+    UTY_ALWAYS_INLINE auto minmax(const float* src_begin, const size_t src_size) noexcept -> std::ranges::min_max_result<float> {
+        return Details::minmax(src_begin, src_size);
+    }
+    UTY_ALWAYS_INLINE auto sum(const float* src_begin, const size_t src_size, const Summation summation = Summation::fast) noexcept -> float {
+        switch (summation) {
+        case Summation::pairwise: return Details::sum_pairwise(src_begin, src_size);
+        case Summation::kahan: return Details::sum_kahan(src_begin, src_size);
+        default: return Details::sum_fast(src_begin, src_size);
+        }
+    }
+    UTY_ALWAYS_INLINE auto argmin(const float* src_begin, const size_t src_size) noexcept -> std::ptrdiff_t {
+        return Details::arg_extreme<false>(src_begin, src_size);
+    }
+    UTY_ALWAYS_INLINE auto argmax(const float* src_begin, const size_t src_size) noexcept -> std::ptrdiff_t {
+        return Details::arg_extreme<true>(src_begin, src_size);
+    }
+}
+
+namespace Utily::Simd512::F64 {
+    UTY_ALWAYS_INLINE auto min(const double* src_begin, const size_t src_size) noexcept -> double {
+        return Details::min(src_begin, src_size);
+    }
+    UTY_ALWAYS_INLINE auto max(const double* src_begin, const size_t src_size) noexcept -> double {
+        return Details::max(src_begin, src_size);
+    }
+    UTY_ALWAYS_INLINE auto minmax(const double* src_begin, const size_t src_size) noexcept -> std::ranges::min_max_result<double> {
+        return Details::minmax(src_begin, src_size);
+    }
+    UTY_ALWAYS_INLINE auto sum(const double* src_begin, const size_t src_size, const Summation summation = Summation::fast) noexcept -> double {
+        switch (summation) {
+        case Summation::pairwise: return Details::sum_pairwise(src_begin, src_size);
+        case Summation::kahan: return Details::sum_kahan(src_begin, src_size);
+        default: return Details::sum_fast(src_begin, src_size);
+        }
+    }
+    UTY_ALWAYS_INLINE auto argmin(const double* src_begin, const size_t src_size) noexcept -> std::ptrdiff_t {
+        return Details::arg_extreme<false>(src_begin, src_size);
+    }
+    UTY_ALWAYS_INLINE auto argmax(const double* src_begin, const size_t src_size) noexcept -> std::ptrdiff_t {
+        return Details::arg_extreme<true>(src_begin, src_size);
+    }
+}
+
+namespace Utily::Simd512::Char::Details {
+    UTY_ALWAYS_INLINE auto load_table(const std::array<uint8_t, 16>& table) noexcept -> __m512i {
+        return _mm512_broadcast_i32x4(_mm_loadu_si128(reinterpret_cast<const __m128i*>(table.data())));
+    }
+
+    // See Simd128::Char::Details::utf8_errors, the byte shifts cross 128-bit lanes through a permute.
+    UTY_ALWAYS_INLINE auto utf8_errors(const __m512i c, const __m512i prev) noexcept -> __m512i {
+        using namespace Simd128::Char::Details;
+        const __m512i nibble = _mm512_set1_epi8(0x0F);
+        const __m512i shifted = _mm512_permutex2var_epi64(prev, _mm512_setr_epi64(6, 7, 8, 9, 10, 11, 12, 13), c);
+        const __m512i prev1 = _mm512_alignr_epi8(c, shifted, 15);
+        const __m512i prev2 = _mm512_alignr_epi8(c, shifted, 14);
+        const __m512i prev3 = _mm512_alignr_epi8(c, shifted, 13);
+
+        const __m512i special = _mm512_and_si512(
+            _mm512_and_si512(
+                _mm512_shuffle_epi8(load_table(Utf8::byte_1_high), _mm512_and_si512(_mm512_srli_epi16(prev1, 4), nibble)),
+                _mm512_shuffle_epi8(load_table(Utf8::byte_1_low), _mm512_and_si512(prev1, nibble))),
+            _mm512_shuffle_epi8(load_table(Utf8::byte_2_high), _mm512_and_si512(_mm512_srli_epi16(c, 4), nibble)));
+        const __m512i must_be_continuation = _mm512_and_si512(
+            _mm512_or_si512(_mm512_subs_epu8(prev2, _mm512_set1_epi8(0xE0 - 0x80)), _mm512_subs_epu8(prev3, _mm512_set1_epi8(static_cast<char>(0xF0 - 0x80)))),
+            _mm512_set1_epi8(static_cast<char>(0x80)));
+        return _mm512_xor_si512(must_be_continuation, special);
+    }
+
+    // Whether the last 3 bytes of `c` start a sequence that runs into the next block.
+    UTY_ALWAYS_INLINE auto utf8_incomplete(const __m512i c) noexcept -> bool {
+        constexpr static auto max_value = [] {
+            std::array<uint8_t, 64> bytes;
+            bytes.fill(0xFF);
+            bytes[61] = 0xF0 - 1;
+            bytes[62] = 0xE0 - 1;
+            bytes[63] = 0xC0 - 1;
+            return bytes;
+        }();
+        const __m512i over = _mm512_subs_epu8(c, _mm512_loadu_si512(max_value.data()));
+        return _mm512_test_epi8_mask(over, over) != 0;
+    }
+}
+
+namespace Utily::Simd512::Char {
+    // See Simd128::Char::find_first_invalid_utf8.
+    UTY_ALWAYS_INLINE auto find_first_invalid_utf8(const char* src_begin, const size_t src_size) noexcept -> std::ptrdiff_t {
+        using namespace Simd128::Char::Details;
+        constexpr static size_t block_size = 64;
+        const auto* src = reinterpret_cast<const uint8_t*>(src_begin);
+
+        const size_t max_i_clamped = src_size - (src_size % block_size);
+
+        __m512i prev = _mm512_setzero_si512();
+        for (size_t i = 0; i < max_i_clamped; i += block_size) {
+            const __m512i c = _mm512_loadu_si512(src + i);
+            bool invalid;
+            if (_mm512_movepi8_mask(c) == 0) {
+                invalid = Details::utf8_incomplete(prev);
+            } else {
+                const __m512i errors = Details::utf8_errors(c, prev);
+                invalid = _mm512_test_epi8_mask(errors, errors) != 0;
+            }
+            if (invalid) {
+                return find_first_invalid_utf8_scalar(src, src_size, utf8_sequence_start(src, i));
+            }
+            prev = c;
         }
-        assert(false && "not implemented");
-        return std::distance(src_begin, std::search(src_begin, src_begin + src_size, val_begin, val_begin + val_size));
+        return find_first_invalid_utf8_scalar(src, src_size, utf8_sequence_start(src, max_i_clamped));
     }
 }
\ No newline at end of file
@@ -16,6 +16,11 @@
 
 #include <Utily/Concepts.hpp>
 
+// The SIMD kernels need SSSE3, reverse splits of char arrays fall back to std::find otherwise.
+#if defined(__SSSE3__)
+#include <Utily/Simd128.hpp>
+#endif
+
 namespace Utily {
 
     namespace Split {
@@ -142,6 +147,129 @@ namespace Utily {
             }
         };
 
+        /*
+         * ByElement walking from the back, the last token comes first. Contiguous char arrays find each
+         * delimiter with Simd128::Char::rfind.
+         */
+        template <std::ranges::bidirectional_range Container, typename Delim = std::ranges::range_value_t<Container>>
+            requires std::equality_comparable_with<Delim, std::ranges::range_value_t<Container>> && (!std::is_reference_v<Container>)
+        class ByElementReverse
+        {
+            using ContainerIter = decltype(std::ranges::cbegin(std::declval<Container&>()));
+            using ContainerValue = std::ranges::range_value_t<Container>;
+
+            const Container& _container;
+            const Delim _delim;
+
+        public:
+            constexpr ByElementReverse(const Container& container, const Delim& delim)
+                : _container(container)
+                , _delim(delim) { }
+
+            ByElementReverse(Container&& container, const Delim& delim) = delete;
+
+            struct Iterator {
+            public:
+                ContainerIter current_begin;
+                ContainerIter current_end;
+                ContainerIter begin;
+                Delim delim;
+
+                constexpr auto operator++() noexcept -> Iterator& {
+                    if (current_begin == begin) {
+                        current_end = begin;
+                        return *this;
+                    }
+                    const auto rend = std::make_reverse_iterator(begin);
+                    current_end = std::find_if_not(std::make_reverse_iterator(current_begin), rend, [&](auto element) { return element == delim; }).base();
+#if defined(__SSSE3__)
+                    if constexpr (std::same_as<ContainerValue, char> && Utily::Concepts::IsContiguousRange<Container>) {
+                        if (!std::is_constant_evaluated()) {
+                            // Most tokens are short, check a vector's worth of bytes before paying for the kernel.
+                            constexpr std::ptrdiff_t scalar_probe = 16;
+                            const auto probe_end = std::distance(begin, current_end) > scalar_probe ? current_end - scalar_probe : begin;
+                            current_begin = std::find(std::make_reverse_iterator(current_end), std::make_reverse_iterator(probe_end), delim).base();
+                            if (current_begin == probe_end && probe_end != begin) {
+                                const auto size = static_cast<size_t>(std::distance(begin, probe_end));
+                                current_begin = begin + (Utily::Simd128::Char::rfind(std::to_address(begin), size, delim) + 1);
+                            }
+                            return *this;
+                        }
+                    }
+#endif
+                    current_begin = std::find(std::make_reverse_iterator(current_end), rend, delim).base();
+                    return *this;
+                }
+
+                constexpr auto operator++(int) noexcept -> Iterator {
+                    Iterator copy = (*this);
+                    ++(*this);
+                    return copy;
+                }
+
+            private:
+                // purely for type deduction
+                consteval static auto dereference_type() {
+                    if constexpr (std::same_as<ContainerValue, char> && Utily::Concepts::IsContiguousRange<Container>) {
+                        return std::string_view {};
+                    } else if constexpr (Utily::Concepts::IsContiguousRange<Container>) {
+                        return std::span<const ContainerValue> {};
+                    } else {
+                        return std::ranges::subrange<ContainerIter, ContainerIter> {};
+                    }
+                }
+                using DereferenceType = std::decay_t<decltype(dereference_type())>;
+
+            public:
+                [[nodiscard]] constexpr auto operator*() const noexcept {
+                    return DereferenceType { current_begin, current_end };
+                }
+
+                using difference_type = std::ptrdiff_t;
+                using value_type = DereferenceType;
+                using reference = std::add_lvalue_reference_t<value_type>;
+                using pointer = std::add_pointer_t<value_type>;
+                using iterator_category = std::forward_iterator_tag;
+
+                [[nodiscard]] constexpr auto operator==(const Iterator& other) const noexcept {
+                    return this->current_begin == other.current_begin && this->current_end == other.current_end && this->begin == other.begin && this->delim == other.delim;
+                }
+                [[nodiscard]] constexpr auto operator!=(const Iterator& other) const noexcept {
+                    return !(*this == other);
+                }
+            };
+
+            using const_iterator = Iterator;
+
+            [[nodiscard]] constexpr auto begin() const noexcept {
+                Iterator iter {
+                    .current_begin = _container.cend(),
+                    .current_end = _container.cend(),
+                    .begin = _container.cbegin(),
+                    .delim = _delim
+                };
+                ++iter;
+                return iter;
+            }
+            [[nodiscard]] constexpr auto end() const noexcept {
+                return Iterator {
+                    .current_begin = _container.cbegin(),
+                    .current_end = _container.cbegin(),
+                    .begin = _container.cbegin(),
+                    .delim = _delim
+                };
+            }
+            [[nodiscard]] constexpr auto cbegin() const noexcept { return begin(); }
+            [[nodiscard]] constexpr auto cend() const noexcept { return end(); }
+
+            [[nodiscard]] constexpr auto evaluate() const noexcept {
+                using SplitType = decltype(*this->begin());
+                std::vector<SplitType> evaluated;
+                std::copy(this->cbegin(), this->cend(), std::back_inserter(evaluated));
+                return evaluated;
+            }
+        };
+
         template <std::ranges::range Container, size_t S, typename Delim = std::ranges::range_value_t<Container>>
             requires(!std::is_reference_v<Container>)
         class ByElements
@@ -279,4 +407,15 @@ namespace Utily {
     template <std::ranges::range Container, typename... Args>
         requires(!std::is_reference_v<Container>)
     auto split(Container&& container, Args&&... args) = delete;
+
+    // Tokens from last to first, see Split::ByElementReverse.
+    template <std::ranges::bidirectional_range Container, typename Delim>
+        requires(!std::is_reference_v<Container>)
+    auto rsplit(const Container& container, const Delim& delim) {
+        return Split::ByElementReverse(container, delim);
+    }
+
+    template <std::ranges::bidirectional_range Container, typename Delim>
+        requires(!std::is_reference_v<Container>)
+    auto rsplit(Container&& container, const Delim& delim) = delete;
 }
\ No newline at end of file
@@ -1,19 +1,34 @@
 #pragma once
 
 #include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
 #include <concepts>
 #include <iostream>
 #include <tuple>
 #include <variant>
 #include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <string>
 
 #include "Utily/Concepts.hpp"
 #include "Utily/TupleAlgo.hpp"
 
 namespace Utily {
-    template <typename T, std::ptrdiff_t S>
-    class StaticVector
+    struct StaticVectorLayout {
+        // Store the size in front of the elements instead of after them.
+        bool size_before_data = false;
+        // Align the whole container, e.g. 16 so a StaticVector<char, 15> can be loaded as one __m128i.
+        size_t alignment = 0;
+    };
+
+    template <typename T, std::ptrdiff_t S, StaticVectorLayout Layout = StaticVectorLayout {}>
+        requires(S > 0 && (Layout.alignment == 0 || std::has_single_bit(Layout.alignment)))
+    class alignas(std::max(Layout.alignment, alignof(T))) StaticVector
     {
         union InternalT {
             std::monostate dummy;
@@ -26,7 +41,7 @@ namespace Utily {
                 : data(t) { }
 
             constexpr InternalT(T&& t)
-                : data(t) { }
+                : data(std::move(t)) { }
 
             constexpr auto operator=(T&& other) -> InternalT& {
                 data = std::forward<T>(other);
@@ -36,22 +51,92 @@ namespace Utily {
                 data = other;
                 return *this;
             }
+            constexpr ~InternalT()
+                requires std::is_trivially_destructible_v<T>
+            = default;
             constexpr ~InternalT() { }
         };
 
-        InternalT _data[static_cast<uint64_t>(S)];
-        std::ptrdiff_t _size;
+        constexpr static bool is_trivial_copy = std::is_trivially_copyable_v<T>;
+
+        // Smallest unsigned type that can count to S.
+        using SizeType = std::conditional_t<(S <= std::numeric_limits<uint8_t>::max()), uint8_t,
+            std::conditional_t<(S <= std::numeric_limits<uint16_t>::max()), uint16_t,
+                std::conditional_t<(S <= std::numeric_limits<uint32_t>::max()), uint32_t, uint64_t>>>;
+
+        struct SizeAfterData {
+            InternalT data[static_cast<uint64_t>(S)];
+            SizeType size = 0;
+        };
+        struct SizeBeforeData {
+            SizeType size = 0;
+            InternalT data[static_cast<uint64_t>(S)];
+        };
+        using Storage = std::conditional_t<Layout.size_before_data, SizeBeforeData, SizeAfterData>;
+
+        Storage _storage;
+
+        [[nodiscard]] constexpr auto get_size() const noexcept -> std::ptrdiff_t { return static_cast<std::ptrdiff_t>(_storage.size); }
+        constexpr void set_size(std::ptrdiff_t n) noexcept { _storage.size = static_cast<SizeType>(n); }
 
     public:
         using value_type = T;
 
         constexpr StaticVector()
-            : _data()
-            , _size(0) {
+            : _storage() {
+        }
+
+        // For trivially copyable types the defaults are kept so the whole StaticVector is trivially copyable.
+        constexpr StaticVector(const StaticVector&)
+            requires is_trivial_copy
+        = default;
+        constexpr StaticVector(const StaticVector& other)
+            requires(!is_trivial_copy && std::is_copy_constructible_v<T>)
+            : _storage() {
+            std::uninitialized_copy_n(other.begin(), other.get_size(), begin());
+            set_size(other.get_size());
+        }
+
+        constexpr StaticVector(StaticVector&&)
+            requires is_trivial_copy
+        = default;
+        constexpr StaticVector(StaticVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+            requires(!is_trivial_copy && std::is_move_constructible_v<T>)
+            : _storage() {
+            std::uninitialized_move_n(other.begin(), other.get_size(), begin());
+            set_size(other.get_size());
+        }
+
+        constexpr auto operator=(const StaticVector&) -> StaticVector& 
+            requires is_trivial_copy
+        = default;
+        constexpr auto operator=(const StaticVector& other) -> StaticVector&
+            requires(!is_trivial_copy && std::is_copy_constructible_v<T>)
+        {
+            if (this != &other) {
+                clear();
+                std::uninitialized_copy_n(other.begin(), other.get_size(), begin());
+                set_size(other.get_size());
+            }
+            return *this;
+        }
+
+        constexpr auto operator=(StaticVector&&) -> StaticVector& 
+            requires is_trivial_copy
+        = default;
+        constexpr auto operator=(StaticVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) -> StaticVector&
+            requires(!is_trivial_copy && std::is_move_constructible_v<T>)
+        {
+            if (this != &other) {
+                clear();
+                std::uninitialized_move_n(other.begin(), other.get_size(), begin());
+                set_size(other.get_size());
+            }
+            return *this;
         }
 
         [[nodiscard]] constexpr auto capacity() const noexcept { return S; }
-        [[nodiscard]] constexpr auto size() const noexcept -> size_t { return static_cast<size_t>(_size); }
+        [[nodiscard]] constexpr auto size() const noexcept -> size_t { return static_cast<size_t>(get_size()); }
 
         struct Iterator {
             using iterator_category = std::contiguous_iterator_tag;
@@ -192,37 +277,39 @@ namespace Utily {
             }
         };
 
-        [[nodiscard]] constexpr auto begin() noexcept -> Iterator { return Iterator { &_data[0] }; }
-        [[nodiscard]] constexpr auto begin() const noexcept -> ConstIterator { return ConstIterator { &_data[0] }; }
+        [[nodiscard]] constexpr auto begin() noexcept -> Iterator { return Iterator { &_storage.data[0] }; }
+        [[nodiscard]] constexpr auto begin() const noexcept -> ConstIterator { return ConstIterator { &_storage.data[0] }; }
 
         template <typename... Args>
             requires((!std::is_reference_v<Args>) && ...)
         constexpr StaticVector(Args&&... args) {
             static_assert(sizeof(InternalT) == sizeof(T), "Should be unreachable");
             static_assert(sizeof...(Args) <= S, "Increase the inital size of the StaticVector");
-            _size = sizeof...(Args);
+            set_size(static_cast<std::ptrdiff_t>(sizeof...(Args)));
 
             std::ptrdiff_t index = 0;
 
             auto construct_inplace_element = [&]<typename Arg>(Arg&& arg) {
-                std::construct_at(&_data[index].data, std::forward<Arg>(arg));
+                std::construct_at(&_storage.data[index].data, std::forward<Arg>(arg));
                 ++index;
             };
 
             Utily::TupleAlgo::for_each(std::forward_as_tuple(std::forward<Args>(args)...), construct_inplace_element);
         }
 
-        [[nodiscard]] constexpr auto end() noexcept -> Iterator { return Iterator { &_data[0] + _size }; }
-        [[nodiscard]] constexpr auto end() const noexcept -> ConstIterator { return ConstIterator { &_data[0] + _size }; }
+        [[nodiscard]] constexpr auto end() noexcept -> Iterator { return Iterator { &_storage.data[0] + get_size() }; }
+        [[nodiscard]] constexpr auto end() const noexcept -> ConstIterator { return ConstIterator { &_storage.data[0] + get_size() }; }
 
         [[nodiscard]] constexpr auto operator[](size_t index) -> T& {
-            return _data[index].data;
+            return _storage.data[index].data;
         }
 
         template <typename... Args>
         constexpr void emplace_back(Args&&... args) {
             if constexpr (std::is_constructible_v<T, Args...>) {
-                std::construct_at(&_data[_size++].data, std::forward<Args>(args)...);
+                assert(get_size() < S);
+                std::construct_at(&_storage.data[get_size()].data, std::forward<Args>(args)...);
+                set_size(get_size() + 1);
             } else {
                 static_assert(std::is_constructible_v<T, Args...>);
             }
@@ -252,12 +339,11 @@ namespace Utily {
             emplace_back(std::forward<T>(element));
         }
 
+        constexpr ~StaticVector()
+            requires std::is_trivially_destructible_v<T>
+        = default;
         constexpr ~StaticVector() {
-            // for (T& element : (*this)) {
-            //     std::destroy_at(&element);
-            // }
-            std::destroy_n(&_data[0].data, _size);
-            //_size = 0;
+            std::destroy_n(&_storage.data[0].data, get_size());
         }
 
         [[nodiscard]] constexpr auto front() -> T& {
@@ -265,19 +351,101 @@ namespace Utily {
         }
 
         [[nodiscard]] constexpr auto back() -> T& {
-            return *(begin() + static_cast<std::ptrdiff_t>(_size) - 1);
+            return *(begin() + static_cast<std::ptrdiff_t>(get_size()) - 1);
         }
 
         constexpr void resize(int n) noexcept {
             const auto nn = static_cast<std::ptrdiff_t>(n);
             assert(n >= 0 && nn <= S);
 
-            if (nn > _size) [[likely]] {
-                std::uninitialized_default_construct_n(&_data[_size].data, nn - _size);
-            } else if (nn < _size) [[unlikely]] {
-                std::destroy_n(&_data[_size - nn - 1].data, _size - nn);
+            if (nn > get_size()) [[likely]] {
+                std::uninitialized_default_construct_n(&_storage.data[get_size()].data, nn - get_size());
+            } else if (nn < get_size()) [[unlikely]] {
+                std::destroy_n(&_storage.data[nn].data, get_size() - nn);
             }
-            _size = nn;
+            set_size(nn);
+        }
+
+        [[nodiscard]] constexpr auto data() noexcept -> T* { return &_storage.data[0].data; }
+        [[nodiscard]] constexpr auto data() const noexcept -> const T* { return &_storage.data[0].data; }
+
+        constexpr void clear() noexcept {
+            std::destroy_n(&_storage.data[0].data, get_size());
+            set_size(0);
+        }
+
+        /*
+            Bulk operations. Trivially copyable types are moved around with memmove/memcpy,
+            everything else goes element by element.
+        */
+        constexpr void assign(std::span<const T> elements) {
+            assert(static_cast<std::ptrdiff_t>(elements.size()) <= S);
+            if constexpr (is_trivial_copy) {
+                if (!std::is_constant_evaluated()) {
+                    std::memmove(data(), elements.data(), elements.size_bytes());
+                    set_size(static_cast<std::ptrdiff_t>(elements.size()));
+                    return;
+                }
+            }
+            clear();
+            std::uninitialized_copy(elements.begin(), elements.end(), begin());
+            set_size(static_cast<std::ptrdiff_t>(elements.size()));
+        }
+
+        constexpr void append(std::span<const T> elements) {
+            assert(get_size() + static_cast<std::ptrdiff_t>(elements.size()) <= S);
+            if constexpr (is_trivial_copy) {
+                if (!std::is_constant_evaluated()) {
+                    std::memmove(data() + get_size(), elements.data(), elements.size_bytes());
+                    set_size(get_size() + static_cast<std::ptrdiff_t>(elements.size()));
+                    return;
+                }
+            }
+            std::uninitialized_copy(elements.begin(), elements.end(), end());
+            set_size(get_size() + static_cast<std::ptrdiff_t>(elements.size()));
+        }
+
+        constexpr auto insert(ConstIterator pos, std::span<const T> elements) -> Iterator {
+            const auto count = static_cast<std::ptrdiff_t>(elements.size());
+            const std::ptrdiff_t index = pos.current - &_storage.data[0];
+            assert(index >= 0 && index <= get_size() && get_size() + count <= S);
+            if constexpr (is_trivial_copy) {
+                if (!std::is_constant_evaluated()) {
+                    std::memmove(data() + index + count, data() + index, static_cast<size_t>(get_size() - index) * sizeof(T));
+                    std::memcpy(data() + index, elements.data(), elements.size_bytes());
+                    set_size(get_size() + count);
+                    return begin() + index;
+                }
+            }
+            const auto old_end = end();
+            append(elements);
+            std::rotate(begin() + index, old_end, end());
+            return begin() + index;
+        }
+
+        constexpr auto insert(ConstIterator pos, const T& element) -> Iterator {
+            return insert(pos, std::span<const T> { &element, 1 });
+        }
+
+        constexpr auto erase(ConstIterator first, ConstIterator last) -> Iterator {
+            const std::ptrdiff_t index = first.current - &_storage.data[0];
+            const std::ptrdiff_t count = last - first;
+            assert(index >= 0 && count >= 0 && index + count <= get_size());
+            if constexpr (is_trivial_copy) {
+                if (!std::is_constant_evaluated()) {
+                    std::memmove(data() + index, data() + index + count, static_cast<size_t>(get_size() - index - count) * sizeof(T));
+                    set_size(get_size() - count);
+                    return begin() + index;
+                }
+            }
+            std::move(begin() + index + count, end(), begin() + index);
+            std::destroy_n(&_storage.data[get_size() - count].data, count);
+            set_size(get_size() - count);
+            return begin() + index;
+        }
+
+        constexpr auto erase(ConstIterator pos) -> Iterator {
+            return erase(pos, pos + 1);
         }
     };
     static_assert(std::contiguous_iterator<StaticVector<int, 10>::Iterator>);
@@ -286,4 +454,9 @@ namespace Utily {
     static_assert(std::ranges::sized_range<StaticVector<int, 10>>);
     static_assert(std::ranges::contiguous_range<StaticVector<int, 10>>);
     static_assert(std::ranges::common_range<StaticVector<int, 10>>);
+    static_assert(std::is_trivially_copyable_v<StaticVector<int, 10>>);
+    static_assert(!std::is_trivially_copyable_v<StaticVector<std::string, 10>>);
+    static_assert(sizeof(StaticVector<char, 15>) == 16);
+    static_assert(sizeof(StaticVector<char, 15, StaticVectorLayout { .size_before_data = true, .alignment = 16 }>) == 16);
+    static_assert(alignof(StaticVector<char, 15, StaticVectorLayout { .alignment = 16 }>) == 16);
 }
\ No newline at end of file
@@ -2,65 +2,142 @@
 
 #include "Utily/Concepts.hpp"
 
+#include <cstddef>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 namespace Utily {
     namespace TupleAlgo {
-        template <typename Tuple, typename Pred, size_t Index = 0>
-            requires(!std::is_reference_v<Tuple>)
-        constexpr auto for_each(Tuple& tuple, Pred pred) -> void {
-            if constexpr (Index == std::tuple_size_v<Tuple>) {
-                return;
-            } else if constexpr (Utily::Concepts::IsCallableWith<Pred, std::tuple_element_t<Index, Tuple>>) {
-                pred(std::get<Index>(tuple));
-                Utily::TupleAlgo::for_each<Tuple, Pred, Index + 1>(tuple, pred);
-            } else {
-                static_assert(Utily::Concepts::IsCallableWith<Pred, std::tuple_element_t<Index, Tuple>>, "Predicate must be callable with all tuple element types");
+        namespace Details {
+            template <typename Tuple>
+            using IndicesOf = std::make_index_sequence<std::tuple_size_v<std::remove_cvref_t<Tuple>>>;
+
+            // Elements are always passed as lvalues, whether the tuple is a temporary or not.
+            template <typename Pred, typename Tuple, size_t... I>
+            constexpr auto is_callable_with_all(std::index_sequence<I...>) -> bool {
+                return (std::is_invocable_v<Pred&, decltype(std::get<I>(std::declval<Tuple&>()))> && ...);
             }
         }
 
-        template <typename Tuple, typename Pred, size_t Index = 0>
-            requires(!std::is_reference_v<Tuple>)
+        /*
+         * Each algorithm expands over std::index_sequence in a single instantiation rather than
+         * recursing per element, and takes the tuple by forwarding reference so lvalue, const and
+         * temporary tuples share one overload.
+         */
+        template <typename Tuple, typename Pred>
         constexpr auto for_each(Tuple&& tuple, Pred pred) -> void {
-            if constexpr (Index == std::tuple_size_v<Tuple>) {
-                return;
-            } else if constexpr (Utily::Concepts::IsCallableWith<Pred, std::tuple_element_t<Index, Tuple>>) {
-                pred(std::get<Index>(tuple));
-                Utily::TupleAlgo::for_each<Tuple, Pred, Index + 1>(tuple, pred);
+            constexpr auto indices = Details::IndicesOf<Tuple> {};
+            if constexpr (Details::is_callable_with_all<Pred, Tuple>(indices)) {
+                [&]<size_t... I>(std::index_sequence<I...>) {
+                    (pred(std::get<I>(tuple)), ...);
+                }(indices);
             } else {
-                static_assert(Utily::Concepts::IsCallableWith<Pred, std::tuple_element_t<Index, Tuple>>, "Predicate must be callable with all tuple element types");
+                static_assert(Details::is_callable_with_all<Pred, Tuple>(indices), "Predicate must be callable with all tuple element types");
             }
         }
 
-        template <typename Tuple, typename Iter, size_t Index = 0>
-            requires(!std::is_reference_v<Tuple>)
-        constexpr auto copy(const Tuple& tuple, Iter iter) -> void {
-            if constexpr (Index == std::tuple_size_v<Tuple>) {
-                return;
-            } else {
-                using TupleElement = std::tuple_element_t<Index, Tuple>;
-                if constexpr (std::is_rvalue_reference_v<TupleElement>) {
-                    *iter = std::forward<std::remove_reference_t<TupleElement>>(std::get<Index>(tuple));
-                } else {
-                    *iter = std::get<Index>(tuple);
-                }
-                copy<Tuple, Iter, Index + 1>(tuple, ++iter);
+        // Calls pred(std::integral_constant<size_t, I> {}, element) so the index can be used as a constant.
+        template <typename Tuple, typename Pred>
+        constexpr auto apply_indexed(Tuple&& tuple, Pred pred) -> void {
+            [&]<size_t... I>(std::index_sequence<I...>) {
+                (pred(std::integral_constant<size_t, I> {}, std::get<I>(tuple)), ...);
+            }(Details::IndicesOf<Tuple> {});
+        }
+
+        // A tuple of func(element) for each element, evaluated in order.
+        template <typename Tuple, typename Func>
+        [[nodiscard]] constexpr auto transform(Tuple&& tuple, Func func) {
+            return [&]<size_t... I>(std::index_sequence<I...>) {
+                using Result = std::tuple<std::invoke_result_t<Func&, decltype(std::get<I>(tuple))>...>;
+                static_assert(!(std::is_void_v<std::tuple_element_t<I, Result>> || ...), "transform needs a function returning a value for every element");
+                // Braced initialisation guarantees left to right evaluation.
+                return Result { func(std::get<I>(tuple))... };
+            }(Details::IndicesOf<Tuple> {});
+        }
+
+        // Index of the first element satisfying pred, or the tuple's size. Stops at the first match.
+        template <typename Tuple, typename Pred>
+        [[nodiscard]] constexpr auto find_if(Tuple&& tuple, Pred pred) -> size_t {
+            size_t found = std::tuple_size_v<std::remove_cvref_t<Tuple>>;
+            [&]<size_t... I>(std::index_sequence<I...>) {
+                static_cast<void>(((pred(std::get<I>(tuple)) ? (found = I, true) : false) || ...));
+            }(Details::IndicesOf<Tuple> {});
+            return found;
+        }
+
+        template <typename Tuple, typename Pred>
+        [[nodiscard]] constexpr auto all_of(Tuple&& tuple, Pred pred) -> bool {
+            return [&]<size_t... I>(std::index_sequence<I...>) {
+                return (static_cast<bool>(pred(std::get<I>(tuple))) && ...);
+            }(Details::IndicesOf<Tuple> {});
+        }
+
+        template <typename Tuple, typename Pred>
+        [[nodiscard]] constexpr auto any_of(Tuple&& tuple, Pred pred) -> bool {
+            return [&]<size_t... I>(std::index_sequence<I...>) {
+                return (static_cast<bool>(pred(std::get<I>(tuple))) || ...);
+            }(Details::IndicesOf<Tuple> {});
+        }
+
+        /*
+         * Element I of the result is a tuple of references to element I of every input, e.g. zipping
+         * the spans of two InlineArrays allocations pairs up their matching columns.
+         */
+        template <typename First, typename... Rest>
+            requires((std::tuple_size_v<First> == std::tuple_size_v<Rest>) && ...)
+        [[nodiscard]] constexpr auto zip(First& first, Rest&... rest) {
+            const auto row = [&]<size_t Index>(std::integral_constant<size_t, Index>) {
+                return std::tie(std::get<Index>(first), std::get<Index>(rest)...);
+            };
+            return [&]<size_t... I>(std::index_sequence<I...>) {
+                return std::make_tuple(row(std::integral_constant<size_t, I> {})...);
+            }(Details::IndicesOf<First> {});
+        }
+
+        /*
+         * Runs pred on every element at once, one thread per element with the last on the calling
+         * thread, and returns when all are done. For per-column work large enough to repay starting a
+         * thread. pred is shared between threads and an exception escaping it terminates.
+         */
+        template <typename Tuple, typename Pred>
+        auto parallel_for_each(Tuple&& tuple, Pred pred) -> void {
+            constexpr size_t size = std::tuple_size_v<std::remove_cvref_t<Tuple>>;
+            static_assert(Details::is_callable_with_all<const Pred, Tuple>(Details::IndicesOf<Tuple> {}), "Predicate must be callable with all tuple element types");
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+            for_each(tuple, pred);
+#else
+            if constexpr (size > 0) {
+                const Pred& shared = pred;
+                std::vector<std::jthread> workers;
+                workers.reserve(size - 1);
+                [&]<size_t... I>(std::index_sequence<I...>) {
+                    ((I + 1 < size ? static_cast<void>(workers.emplace_back([&shared, &element = std::get<I>(tuple)] { shared(element); }))
+                                   : static_cast<void>(shared(std::get<I>(tuple)))),
+                        ...);
+                }(Details::IndicesOf<Tuple> {});
             }
+#endif
         }
 
-        template <typename Tuple, typename Iter, size_t Index = 0>
-            requires(!std::is_reference_v<Tuple>)
+        // Assigns each element to *iter++, moving elements held by rvalue reference.
+        template <typename Tuple, typename Iter>
         constexpr auto copy(Tuple&& tuple, Iter iter) -> void {
-            if constexpr (Index == std::tuple_size_v<Tuple>) {
-                return;
-            } else {
-                using TupleElement = std::tuple_element_t<Index, Tuple>;
-                if constexpr (std::is_rvalue_reference_v<TupleElement>) {
-                    *iter = std::forward<std::remove_reference_t<TupleElement>>(std::get<Index>(tuple));
-                } else {
-                    *iter = std::get<Index>(tuple);
-                }
-                copy<Tuple, Iter, Index + 1>(tuple, ++iter);
-            }
+            [&]<size_t... I>(std::index_sequence<I...>) {
+                const auto assign = [&]<size_t Index>(std::integral_constant<size_t, Index>) {
+                    using Element = std::tuple_element_t<Index, std::remove_cvref_t<Tuple>>;
+                    if constexpr (std::is_rvalue_reference_v<Element>) {
+                        *iter = std::forward<std::remove_reference_t<Element>>(std::get<Index>(tuple));
+                    } else {
+                        *iter = std::get<Index>(tuple);
+                    }
+                    ++iter;
+                };
+                (assign(std::integral_constant<size_t, I> {}), ...);
+            }(Details::IndicesOf<Tuple> {});
         }
 
     }
-}
\ No newline at end of file
+}
@@ -10,6 +10,7 @@
 #include <stdexcept>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 
 #ifdef _MSC_VER
 #include <malloc.h>
@@ -30,7 +31,7 @@ namespace Utily {
     {
     private:
         // type related.
-        std::string_view _type_name;
+        uint64_t _type_id;
         size_t _type_alignment;
         size_t _type_size;
         // data related.
@@ -80,7 +81,7 @@ namespace Utily {
 
     public:
         UTY_ALWAYS_INLINE constexpr TypeErasedVector() noexcept
-            : _type_name("")
+            : _type_id(0)
             , _type_alignment(0)
             , _type_size(0)
             , _data_size(0)
@@ -89,7 +90,7 @@ namespace Utily {
 
         template <typename T>
         UTY_ALWAYS_INLINE constexpr TypeErasedVector(T t [[maybe_unused]]) noexcept
-            : _type_name(Utily::Reflection::get_type_name<T>())
+            : _type_id(Utily::Reflection::get_type_id<T>())
             , _type_alignment(alignof(T))
             , _type_size(sizeof(T))
             , _data_size(0)
@@ -100,7 +101,7 @@ namespace Utily {
 
         template <typename T>
         UTY_ALWAYS_INLINE constexpr TypeErasedVector(T t [[maybe_unused]], size_t n)
-            : _type_name(Utily::Reflection::get_type_name<T>())
+            : _type_id(Utily::Reflection::get_type_id<T>())
             , _type_alignment(alignof(T))
             , _type_size(sizeof(T))
             , _data_size(0)
@@ -113,7 +114,7 @@ namespace Utily {
         TypeErasedVector(const TypeErasedVector&) = delete;
 
         constexpr TypeErasedVector(TypeErasedVector&& other) noexcept
-            : _type_name(std::exchange(other._type_name, ""))
+            : _type_id(std::exchange(other._type_id, 0))
             , _type_alignment(std::exchange(other._type_alignment, 0))
             , _type_size(std::exchange(other._type_size, 0))
             , _data_size(std::exchange(other._data_size, 0))
@@ -134,10 +135,10 @@ namespace Utily {
         template <typename T>
         UTY_ALWAYS_INLINE constexpr void set_underlying_type() {
             static_assert(std::is_trivially_destructible_v<T>, "The type must not have a destuctor.");
-            assert(_type_alignment == 0 && _type_size == 0 && _type_name == "");
+            assert(_type_alignment == 0 && _type_size == 0 && _type_id == 0);
             assert(_data == nullptr && _data_size == 0 && _data_capacity == 0);
 
-            _type_name = Utily::Reflection::get_type_name<T>();
+            _type_id = Utily::Reflection::get_type_id<T>();
             _type_alignment = alignof(T);
             _type_size = sizeof(T);
         }
@@ -145,7 +146,7 @@ namespace Utily {
         template <typename T>
         UTY_ALWAYS_INLINE void push_back(T&& t) {
             static_assert(!std::is_same_v<T, void>, "Cannot push back void type");
-            assert(Utily::Reflection::get_type_name<T>() == _type_name);
+            assert(Utily::Reflection::get_type_id<T>() == _type_id);
             ensure_pushable_capacity();
             std::construct_at(
                 reinterpret_cast<T*>(static_cast<std::byte*>(_data) + (_data_size * static_cast<std::ptrdiff_t>(_type_size))),
@@ -156,7 +157,7 @@ namespace Utily {
         template <typename T, typename... Args>
         UTY_ALWAYS_INLINE void emplace_back(Args&&... args) {
             static_assert(!std::is_same_v<T, void>, "Cannot emplace back void type");
-            assert(Utily::Reflection::get_type_name<T>() == _type_name);
+            assert(Utily::Reflection::get_type_id<T>() == _type_id);
             ensure_pushable_capacity();
             std::construct_at(
                 reinterpret_cast<T*>(static_cast<std::byte*>(_data) + (_data_size * static_cast<std::ptrdiff_t>(_type_size))),
@@ -179,7 +180,7 @@ namespace Utily {
 
         template <typename T>
         [[nodiscard]] UTY_ALWAYS_INLINE auto at(std::ptrdiff_t index) -> T& {
-            assert(Utily::Reflection::get_type_name<T>() == _type_name);
+            assert(Utily::Reflection::get_type_id<T>() == _type_id);
             assert(_data != nullptr);
             assert(index < _data_size);
             return *reinterpret_cast<T*>(static_cast<int8_t*>(_data) + (index * _type_size));
@@ -191,7 +192,7 @@ namespace Utily {
 
         template <typename T>
         [[nodiscard]] auto UTY_ALWAYS_INLINE as_span() -> std::span<T> {
-            assert(Utily::Reflection::get_type_name<T>() == _type_name);
+            assert(Utily::Reflection::get_type_id<T>() == _type_id);
             return std::span<T>(reinterpret_cast<T*>(_data), reinterpret_cast<T*>(_data) + _data_size);
         }
 
@@ -4,11 +4,15 @@
 #include "Utily/Concepts.hpp"
 #include "Utily/TupleAlgo.hpp"
 #include "Utily/Split.hpp"
+#include "Utily/Pipeline.hpp"
 #include "Utily/StaticVector.hpp"
 #include "Utily/Error.hpp"
 #include "Utily/ErrorHandler.hpp"
 #include "Utily/Result.hpp"
+#include "Utily/ResultBatch.hpp"
+#include "Utily/Serialize.hpp"
 #include "Utily/FileReader.hpp"
 #include "Utily/FileWriter.hpp"
+#include "Utily/Ply.hpp"
 #include "Utily/AsyncFileReader.hpp"
 #include "Utily/InlineArrays.hpp"
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "Utily/Error.hpp"
+#include "Utily/Result.hpp"
+#include "Utily/Simd128.hpp"
+#if defined(__AVX512BW__)
+#include "Utily/Simd512.hpp"
+#endif
+
+/*
+ * Result-returning checks over the Simd128 and Simd512 kernels, kept out of those headers so they
+ * stay free of Error and Result.
+ */
+namespace Utily::ValidateDetails {
+    constexpr auto to_result(const std::ptrdiff_t offset, const size_t size, const Utily::Error::Code code) noexcept
+        -> Utily::Result<void, Utily::Error> {
+        if (static_cast<size_t>(offset) != size) {
+            return Utily::Error { code, static_cast<uint64_t>(offset) };
+        }
+        return {};
+    }
+}
+
+namespace Utily::Simd128::Char {
+    // The error gives the offset of the first non-ASCII byte.
+    UTY_ALWAYS_INLINE auto is_ascii(const std::span<const char> src) -> Utily::Result<void, Utily::Error> {
+        return ValidateDetails::to_result(find_first_non_ascii(src.data(), src.size()), src.size(), Utily::Error::Code::non_ascii);
+    }
+
+    // The error gives the offset of the first byte of the first invalid sequence.
+    UTY_ALWAYS_INLINE auto validate_utf8(const std::span<const char> src) -> Utily::Result<void, Utily::Error> {
+        return ValidateDetails::to_result(find_first_invalid_utf8(src.data(), src.size()), src.size(), Utily::Error::Code::invalid_utf8);
+    }
+}
+
+#if defined(__AVX512BW__)
+namespace Utily::Simd512::Char {
+    UTY_ALWAYS_INLINE auto is_ascii(const std::span<const char> src) -> Utily::Result<void, Utily::Error> {
+        return ValidateDetails::to_result(find_first_non_ascii(src.data(), src.size()), src.size(), Utily::Error::Code::non_ascii);
+    }
+
+    UTY_ALWAYS_INLINE auto validate_utf8(const std::span<const char> src) -> Utily::Result<void, Utily::Error> {
+        return ValidateDetails::to_result(find_first_invalid_utf8(src.data(), src.size()), src.size(), Utily::Error::Code::invalid_utf8);
+    }
+}
+#endif
+
+namespace Utily {
+    // The widest of the above the target has.
+    UTY_ALWAYS_INLINE auto is_ascii(const std::span<const char> src) -> Utily::Result<void, Utily::Error> {
+#if defined(__AVX512BW__)
+        return Simd512::Char::is_ascii(src);
+#else
+        return Simd128::Char::is_ascii(src);
+#endif
+    }
+
+    UTY_ALWAYS_INLINE auto validate_utf8(const std::span<const char> src) -> Utily::Result<void, Utily::Error> {
+#if defined(__AVX512BW__)
+        return Simd512::Char::validate_utf8(src);
+#else
+        return Simd128::Char::validate_utf8(src);
+#endif
+    }
+}
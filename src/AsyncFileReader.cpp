@@ -5,7 +5,6 @@
 
 #elif defined(__EMSCRIPTEN__) || defined(EMSCRIPTEN)
 #include <emscripten/emscripten.h>
-#include <format>
 #include <iostream>
 #include <span>
 
@@ -71,6 +70,7 @@ namespace Utily {
         }
 
         const auto file_str = file_path.string();
+        const auto path_hash = std::filesystem::hash_value(file_path);
 
         FileDataUnfulfilled file_data {};
 
@@ -85,19 +85,11 @@ namespace Utily {
 
         if (file_data.get_stream() == INVALID_HANDLE_VALUE) {
             file_data.get_stream() = nullptr;
-            return Utily::Error {
-                std::format(
-                    "File \"{}\" does not exist.",
-                    file_str)
-            };
+            return Utily::Error { Utily::Error::Code::file_not_found, path_hash };
         }
 
         if (LARGE_INTEGER temp; !GetFileSizeEx(file_data.get_stream(), &temp)) {
-            return Utily::Error {
-                std::format(
-                    "File \"{}\" did not allow us to read the file's size.",
-                    file_str)
-            };
+            return Utily::Error { Utily::Error::Code::file_open_failed, path_hash };
         } else {
             file_data.contents.resize(static_cast<size_t>(temp.QuadPart));
         }
@@ -106,11 +98,7 @@ namespace Utily {
             std::move(file_data));
 
         if (!was_inserted_successfully) {
-            return Utily::Error {
-                std::format(
-                    "File \"{}\" is already queued.",
-                    file_str)
-            };
+            return Utily::Error { Utily::Error::Code::file_already_queued, path_hash };
         }
 
         auto& [path, file_data_ref] = *iter;
@@ -126,11 +114,7 @@ namespace Utily {
             CloseHandle(file_data_ref.get_stream());
             file_data_ref.get_stream() = nullptr;
             files_unfulfilled.erase(iter);
-            return Utily::Error {
-                std::format(
-                    "File \"{}\" was opened but able to be read.",
-                    file_str)
-            };
+            return Utily::Error { Utily::Error::Code::file_read_failed, path_hash };
         }
 
         return {};
@@ -144,17 +128,9 @@ namespace Utily {
             return value;
 
         } else if (files_unfulfilled.contains(file_path)) {
-            return Utily::Error {
-                std::format(
-                    "File \"{}\" has not finished loading.",
-                    file_path.generic_string())
-            };
+            return Utily::Error { Utily::Error::Code::file_not_loaded, std::filesystem::hash_value(file_path) };
         } else {
-            return Utily::Error {
-                std::format(
-                    "File \"{}\" was not pushed to be loaded.",
-                    file_path.generic_string())
-            };
+            return Utily::Error { Utily::Error::Code::file_not_queued, std::filesystem::hash_value(file_path) };
         }
     }
 
@@ -202,7 +178,7 @@ namespace Utily {
 
     void AsyncFileReader::file_fail_callback(void* arg) {
         const std::filesystem::path& path = *reinterpret_cast<std::filesystem::path*>(arg);
-        std::cerr << std::format("File \"{}\" failed to load.", path.string());
+        std::cerr << "File \"" << path.string() << "\" failed to load.";
         files_unfulfilled.erase(path);
     }
 
@@ -211,21 +187,15 @@ namespace Utily {
             return {};
         }
 
-        auto file_str = file_path.string();
-
         if (!std::filesystem::exists(file_path)) {
-            return Utily::Error {
-                std::format(
-                    "File \"{}\" does not exist.",
-                    file_str)
-            };
+            return Utily::Error { Utily::Error::Code::file_not_found, std::filesystem::hash_value(file_path) };
         }
 
         return {};
     }
 
     auto AsyncFileReader::pop(std::filesystem::path file_path [[maybe_unused]]) -> Utily::Result<std::vector<char>, Utily::Error> {
-        return Utily::Error { "Not implemented" };
+        return Utily::Error { Utily::Error::Code::not_implemented };
     }
 
     void AsyncFileReader::wait_for_all() {
@@ -233,7 +203,7 @@ namespace Utily {
     }
 
     auto AsyncFileReader::wait_pop(std::filesystem::path file_path) -> Utily::Result<std::vector<char>, Utily::Error> {
-        return Utily::Error("Not implemented");
+        return Utily::Error { Utily::Error::Code::not_implemented };
     }
 
     
@@ -1,6 +1,6 @@
 #include "Utily/FileReader.hpp"
 
-#include <format>
+#include <cerrno>
 
 #if defined(_WIN32)
 #include <Windows.h>
@@ -22,8 +22,7 @@ namespace Utily {
             NULL);
 
         if (handle == INVALID_HANDLE_VALUE) {
-            auto fp_string = file_path.string();
-            return Utily::Error { std::format("The file {} does not exist.", fp_string) };
+            return Utily::Error { Utily::Error::Code::file_not_found, std::filesystem::hash_value(file_path) };
         }
 
         static_assert(sizeof(unsigned long) == sizeof(uint32_t));
@@ -35,14 +34,7 @@ namespace Utily {
         std::vector<uint8_t> buffer(size);
 
         if (size > buffer.max_size()) [[unlikely]] {
-            auto fp_string = file_path.string();
-            return Utily::Error {
-                std::format(
-                    "Failed to read {} as the file's size ({}) cannot fit into a vector<uint8_t> ({})",
-                    fp_string,
-                    size,
-                    buffer.max_size())
-            };
+            return Utily::Error { Utily::Error::Code::file_too_large, std::filesystem::hash_value(file_path), size, buffer.max_size() };
         }
 
         // necessary to read stuff over 4GB
@@ -60,14 +52,7 @@ namespace Utily {
             i += bytes_read;
 
             if (!is_good_read || bytes_read == 0) [[unlikely]] {
-                auto fp_string = file_path.string();
-                return Utily::Error {
-                    std::format(
-                        "The file {} had a bad read. Need to read {} bytes, actually read {} bytes",
-                        fp_string,
-                        bytes_to_read,
-                        bytes_read)
-                };
+                return Utily::Error { Utily::Error::Code::file_read_failed, std::filesystem::hash_value(file_path), i, size };
             }
         }
 
@@ -104,7 +89,7 @@ namespace Utily {
         }
 
         if (handle == -1) {
-            return Utily::Error { std::format("The file {} could not be opened.", fp) };
+            return Utily::Error { Utily::Error::Code::file_open_failed, std::filesystem::hash_value(file_path) }.with_errno(errno);
         }
 
         size_t file_size = static_cast<size_t>(lseek(handle, 0, SEEK_END));
@@ -134,7 +119,7 @@ namespace Utily {
         auto fp = file_path.c_str();
 
         if (!std::filesystem::exists(file_path)) {
-            return Utily::Error { std::format("The file {} does not exist.", fp) };
+            return Utily::Error { Utily::Error::Code::file_not_found, std::filesystem::hash_value(file_path) };
         }
 
         constexpr bool NeedsPathConversion = std::same_as<std::filesystem::path::value_type, char>;
@@ -149,7 +134,7 @@ namespace Utily {
         }
 
         if (handle == nullptr) {
-            return Utily::Error { std::format("The file {} could not be opened.", fp) };
+            return Utily::Error { Utily::Error::Code::file_open_failed, std::filesystem::hash_value(file_path) }.with_errno(errno);
         }
 
         fseek(handle, 0, SEEK_END);
@@ -160,7 +145,9 @@ namespace Utily {
         size_t bytes_read = fread(buffer.data(), sizeof(uint8_t), file_size, handle);
 
         if (bytes_read != file_size) {
-            return Utily::Error { std::format("The file {} opened but failed whilst reading.", fp) };
+            const int error_number = errno;
+            fclose(handle);
+            return Utily::Error { Utily::Error::Code::file_read_failed, std::filesystem::hash_value(file_path), bytes_read, file_size }.with_errno(error_number);
         }
         fclose(handle);
         return buffer;
@@ -1,6 +1,6 @@
 #include "Utily/FileWriter.hpp"
 
-#include <format>
+#include <cerrno>
 
 #if defined(_WIN32)
 #include <Windows.h>
@@ -22,8 +22,7 @@ namespace Utily {
             NULL);
 
         if (handle == INVALID_HANDLE_VALUE) {
-            auto fp_string = file_path.string();
-            return Utily::Error { std::format("The file {} could not be created or opened.", fp_string) };
+            return Utily::Error { Utily::Error::Code::file_open_failed, std::filesystem::hash_value(file_path) };
         }
 
         DWORD bytes_written = 0;
@@ -38,8 +37,7 @@ namespace Utily {
         CloseHandle(handle);
 
         if (!has_wrote_file || bytes_written != data.size_bytes()) {
-            auto fp_string = file_path.string();
-            return Utily::Error { std::format("The file {} could not write all the data. Only {}/{} bytes written.", fp_string, bytes_written, data.size_bytes()) };
+            return Utily::Error { Utily::Error::Code::file_write_failed, std::filesystem::hash_value(file_path), bytes_written, data.size_bytes() };
         }
 
         return {};
@@ -69,7 +67,7 @@ namespace Utily {
         }
 
         if (!handle) {
-            return Utily::Error { std::format("The file {} could not be opened/created.", file_path.string()) };
+            return Utily::Error { Utily::Error::Code::file_open_failed, std::filesystem::hash_value(file_path) }.with_errno(errno);
         }
 
         fwrite(data.data(), 1, data.size_bytes(), handle);
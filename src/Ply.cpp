@@ -0,0 +1,624 @@
+#include "Utily/Ply.hpp"
+
+#include "Utily/FileReader.hpp"
+#include "Utily/InlineArrays.hpp"
+#include "Utily/Parse.hpp"
+#include "Utily/Split.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cstring>
+#include <functional>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Utily {
+    namespace {
+        using Code = Utily::Error::Code;
+
+        enum class Format : uint8_t {
+            ascii,
+            binary_little_endian,
+        };
+
+        enum class Type : uint8_t {
+            none,
+            int8,
+            uint8,
+            int16,
+            uint16,
+            int32,
+            uint32,
+            float32,
+            float64,
+        };
+
+        struct Property {
+            std::string_view name;
+            Type type = Type::none;
+            Type count_type = Type::none; // set for lists, type is then the element type.
+        };
+
+        struct Element {
+            std::string_view name;
+            size_t count = 0;
+            size_t header_offset = 0;
+            std::vector<Property> properties;
+        };
+
+        struct Header {
+            Format format = Format::ascii;
+            std::vector<Element> elements;
+            size_t body_offset = 0;
+        };
+
+        auto parse_type(const std::string_view name) -> Type {
+            constexpr static std::array<std::pair<std::string_view, Type>, 16> names { {
+                { "char", Type::int8 },
+                { "uchar", Type::uint8 },
+                { "short", Type::int16 },
+                { "ushort", Type::uint16 },
+                { "int", Type::int32 },
+                { "uint", Type::uint32 },
+                { "float", Type::float32 },
+                { "double", Type::float64 },
+                { "int8", Type::int8 },
+                { "uint8", Type::uint8 },
+                { "int16", Type::int16 },
+                { "uint16", Type::uint16 },
+                { "int32", Type::int32 },
+                { "uint32", Type::uint32 },
+                { "float32", Type::float32 },
+                { "float64", Type::float64 },
+            } };
+            const auto found = std::find_if(names.begin(), names.end(), [&](const auto& entry) { return entry.first == name; });
+            return found == names.end() ? Type::none : found->second;
+        }
+
+        constexpr auto size_of(const Type type) noexcept -> size_t {
+            switch (type) {
+            case Type::int8:
+            case Type::uint8:
+                return 1;
+            case Type::int16:
+            case Type::uint16:
+                return 2;
+            case Type::int32:
+            case Type::uint32:
+            case Type::float32:
+                return 4;
+            case Type::float64:
+                return 8;
+            default:
+                return 0;
+            }
+        }
+
+        // The value at `p` as T. The body is little-endian, as is every supported host.
+        template <typename T>
+        auto read_as(const Type type, const uint8_t* p) noexcept -> T {
+            const auto read = [p]<typename Stored>(Stored value) {
+                std::memcpy(&value, p, sizeof(Stored));
+                return static_cast<T>(value);
+            };
+            switch (type) {
+            case Type::int8:
+                return read(int8_t {});
+            case Type::uint8:
+                return read(uint8_t {});
+            case Type::int16:
+                return read(int16_t {});
+            case Type::uint16:
+                return read(uint16_t {});
+            case Type::int32:
+                return read(int32_t {});
+            case Type::uint32:
+                return read(uint32_t {});
+            case Type::float32:
+                return read(float {});
+            case Type::float64:
+                return read(double {});
+            default:
+                return T {};
+            }
+        }
+
+        auto header_error(const std::string_view text, const size_t offset) -> Utily::Error {
+            const auto line = text.substr(offset, text.find_first_of("\r\n", offset) - offset);
+            return Utily::Error { Code::ply_invalid_header, offset }.with_detail(line);
+        }
+
+        auto parse_header(const std::string_view text) -> Utily::Result<Header, Utily::Error> {
+            Header header;
+            bool has_format = false;
+            size_t offset = 0;
+            for (size_t line_number = 0;; ++line_number) {
+                const size_t line_end = text.find('\n', offset);
+                if (line_end == std::string_view::npos) {
+                    return header_error(text, offset);
+                }
+                std::string_view line = text.substr(offset, line_end - offset);
+                if (line.ends_with('\r')) {
+                    line.remove_suffix(1);
+                }
+
+                std::array<std::string_view, 5> words;
+                size_t word_count = 0;
+                for (std::string_view word : Utily::split(line, ' ')) {
+                    if (word_count < words.size()) {
+                        words[word_count] = word;
+                    }
+                    ++word_count;
+                }
+                const std::string_view keyword = words[0];
+                const auto is_count = [](const std::string_view word, size_t& count) {
+                    const auto [end, ec] = std::from_chars(word.data(), word.data() + word.size(), count);
+                    return ec == std::errc {} && end == word.data() + word.size();
+                };
+
+                if (line_number == 0) {
+                    if (word_count != 1 || keyword != "ply") {
+                        return header_error(text, offset);
+                    }
+                } else if (keyword == "comment" || keyword == "obj_info") {
+                    // Free text.
+                } else if (keyword == "end_header" && word_count == 1) {
+                    if (!has_format) {
+                        return header_error(text, offset);
+                    }
+                    header.body_offset = line_end + 1;
+                    return header;
+                } else if (keyword == "format" && word_count == 3 && !has_format) {
+                    if (words[1] == "ascii") {
+                        header.format = Format::ascii;
+                    } else if (words[1] == "binary_little_endian") {
+                        header.format = Format::binary_little_endian;
+                    } else {
+                        return Utily::Error { Code::ply_unsupported, offset }.with_detail(words[1]);
+                    }
+                    has_format = true;
+                } else if (keyword == "element" && word_count == 3) {
+                    Element element { .name = words[1], .header_offset = offset, .properties = {} };
+                    if (!is_count(words[2], element.count)) {
+                        return header_error(text, offset);
+                    }
+                    // The mesh is sized from the one vertex and one face element.
+                    const bool is_repeated = (element.name == "vertex" || element.name == "face")
+                        && std::any_of(header.elements.begin(), header.elements.end(), [&](const Element& e) { return e.name == element.name; });
+                    if (is_repeated) {
+                        return header_error(text, offset);
+                    }
+                    header.elements.push_back(std::move(element));
+                } else if (keyword == "property" && word_count == 3 && !header.elements.empty()) {
+                    const Type type = parse_type(words[1]);
+                    if (type == Type::none) {
+                        return header_error(text, offset);
+                    }
+                    header.elements.back().properties.push_back(Property { .name = words[2], .type = type });
+                } else if (keyword == "property" && word_count == 5 && words[1] == "list" && !header.elements.empty()) {
+                    const Type count_type = parse_type(words[2]);
+                    const Type type = parse_type(words[3]);
+                    if (count_type == Type::none || type == Type::none || count_type == Type::float32 || count_type == Type::float64) {
+                        return header_error(text, offset);
+                    }
+                    header.elements.back().properties.push_back(Property { .name = words[4], .type = type, .count_type = count_type });
+                } else {
+                    return header_error(text, offset);
+                }
+                offset = line_end + 1;
+            }
+        }
+
+        // Where x, y and z are among the vertex properties.
+        auto position_columns(const Element& vertex) -> Utily::Result<std::array<size_t, 3>, Utily::Error> {
+            std::array<size_t, 3> columns;
+            constexpr static std::array<std::string_view, 3> names { "x", "y", "z" };
+            for (size_t axis = 0; axis < 3; ++axis) {
+                const auto found = std::find_if(vertex.properties.begin(), vertex.properties.end(), [&](const Property& p) { return p.name == names[axis]; });
+                if (found == vertex.properties.end() || found->count_type != Type::none) {
+                    return Utily::Error { Code::ply_unsupported, vertex.header_offset }.with_detail("vertex without x, y, z");
+                }
+                columns[axis] = static_cast<size_t>(found - vertex.properties.begin());
+            }
+            for (const Property& property : vertex.properties) {
+                if (property.count_type != Type::none) {
+                    return Utily::Error { Code::ply_unsupported, vertex.header_offset }.with_detail("vertex list");
+                }
+            }
+            return columns;
+        }
+
+        // Each element is written only within the mesh arrays, whatever the header's counts add up to.
+        auto check_fits(const Element& element, const std::span<const float> positions, const std::span<const uint32_t> indices)
+            -> Utily::Result<void, Utily::Error> {
+            const size_t capacity = (element.name == "vertex" ? positions.size() : indices.size()) / 3;
+            if (element.count > capacity) {
+                return Utily::Error { Code::ply_invalid_header, element.header_offset }.with_detail(element.name);
+            }
+            return {};
+        }
+
+        auto check_face(const Element& face) -> Utily::Result<void, Utily::Error> {
+            if (face.properties.size() != 1 || face.properties[0].count_type == Type::none
+                || face.properties[0].type == Type::float32 || face.properties[0].type == Type::float64) {
+                return Utily::Error { Code::ply_unsupported, face.header_offset }.with_detail("face properties");
+            }
+            return {};
+        }
+
+        // The offset just past the `lines`th line break from `begin`, or the end of the text when it has fewer.
+        auto skip_lines(const std::string_view text, const size_t begin, size_t lines) noexcept -> size_t {
+            constexpr static size_t block_size = 64;
+            size_t base = begin;
+            while (lines > 0 && base < text.size()) {
+                uint64_t mask;
+                if (base + block_size <= text.size()) {
+                    mask = Parse::Details::equal_mask(text.data() + base, '\n');
+                } else {
+                    std::array<char, block_size> tail {};
+                    std::memcpy(tail.data(), text.data() + base, text.size() - base);
+                    mask = Parse::Details::equal_mask(tail.data(), '\n');
+                }
+                const auto found = static_cast<size_t>(std::popcount(mask));
+                if (found < lines) {
+                    lines -= found;
+                    base += block_size;
+                    continue;
+                }
+                for (; lines > 1; --lines) {
+                    mask &= mask - 1;
+                }
+                return base + static_cast<size_t>(std::countr_zero(mask)) + 1;
+            }
+            return std::min(base, text.size());
+        }
+
+        /*
+            The offset of the first line in `text` not holding exactly `values_per_line` values, or npos. Token
+            starts come from Parse's separator mask and are counted between the line breaks of each 64 byte block.
+        */
+        auto find_miscounted_line(const std::string_view text, const size_t values_per_line) noexcept -> size_t {
+            constexpr static size_t block_size = 64;
+            size_t line_begin = 0;
+            size_t values = 0;
+            uint64_t separator_before = 1;
+            for (size_t base = 0; base < text.size(); base += block_size) {
+                uint64_t separators;
+                uint64_t newlines;
+                if (base + block_size <= text.size()) {
+                    separators = Parse::Details::separator_mask(text.data() + base, ' ');
+                    newlines = Parse::Details::equal_mask(text.data() + base, '\n');
+                } else {
+                    std::array<char, block_size> tail;
+                    tail.fill(' ');
+                    std::memcpy(tail.data(), text.data() + base, text.size() - base);
+                    separators = Parse::Details::separator_mask(tail.data(), ' ');
+                    newlines = Parse::Details::equal_mask(tail.data(), '\n');
+                }
+                uint64_t starts = ~separators & ((separators << 1) | separator_before);
+                separator_before = separators >> 63;
+
+                for (; newlines != 0; newlines &= newlines - 1) {
+                    const auto line_end = static_cast<size_t>(std::countr_zero(newlines));
+                    const uint64_t before = (uint64_t { 1 } << line_end) - 1;
+                    values += static_cast<size_t>(std::popcount(starts & before));
+                    starts &= ~before;
+                    if (values != values_per_line) {
+                        return line_begin;
+                    }
+                    values = 0;
+                    line_begin = base + line_end + 1;
+                }
+                values += static_cast<size_t>(std::popcount(starts));
+            }
+            // A last line without a line break.
+            return values != 0 && values != values_per_line ? line_begin : std::string_view::npos;
+        }
+
+        struct Chunk {
+            size_t begin = 0;
+            size_t end = 0;
+            size_t first_line = 0;
+            size_t lines = 0;
+            size_t miscounted_line = std::string_view::npos;
+            Parse::Details::Progress progress {};
+        };
+
+        /*
+            Parses an ASCII element of `lines` lines holding `values_per_line` values each into `out`. The lines
+            are split evenly between threads, each runs Parse's tokeniser over its own range of the text and
+            writes straight to its own range of `out`. Gives the offset just past the element.
+        */
+        template <typename T, typename Convert>
+        auto parse_ascii_element(const std::string_view text, const size_t begin, const size_t lines, const size_t values_per_line,
+            std::span<T> out, const Ply::Options& options, const Convert& convert)
+            -> Utily::Result<size_t, Utily::Error> {
+            if (lines > out.size() / std::max(values_per_line, size_t { 1 })) {
+                return Utily::Error { Code::ply_value_count, begin, values_per_line };
+            }
+            const size_t end = skip_lines(text, begin, lines);
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+            const size_t num_threads = 1;
+#else
+            const size_t num_threads = std::clamp((end - begin) / std::max(options.min_bytes_per_thread, size_t { 1 }),
+                size_t { 1 }, std::clamp(options.max_threads, size_t { 1 }, std::max(lines, size_t { 1 })));
+#endif
+            std::vector<Chunk> chunks(num_threads);
+            size_t offset = begin;
+            for (size_t t = 0; t < num_threads; ++t) {
+                Chunk& chunk = chunks[t];
+                chunk.first_line = lines * t / num_threads;
+                chunk.lines = lines * (t + 1) / num_threads - chunk.first_line;
+                chunk.begin = offset;
+                chunk.end = t + 1 == num_threads ? end : skip_lines(text, offset, chunk.lines);
+                offset = chunk.end;
+            }
+
+            const auto parse_chunk = [&](Chunk& chunk) {
+                const auto chunk_text = text.substr(chunk.begin, chunk.end - chunk.begin);
+                const std::span<T> chunk_out = out.subspan(chunk.first_line * values_per_line, chunk.lines * values_per_line);
+                chunk.progress = Parse::Details::parse_tokens(chunk_text, ' ', chunk_out.data(), chunk_out.size(), convert);
+                if (chunk.progress.status == Parse::Details::Status::done) {
+                    chunk.miscounted_line = find_miscounted_line(chunk_text, values_per_line);
+                }
+            };
+            {
+                std::vector<std::jthread> workers;
+                workers.reserve(num_threads - 1);
+                for (size_t t = 1; t < num_threads; ++t) {
+                    workers.emplace_back(parse_chunk, std::ref(chunks[t]));
+                }
+                parse_chunk(chunks[0]);
+            }
+
+            for (const Chunk& chunk : chunks) {
+                Parse::Details::Progress progress = chunk.progress;
+                progress.offset += chunk.begin;
+                if (progress.status == Parse::Details::Status::invalid) {
+                    return Parse::Details::parse_error<T>(text, ' ', progress, 0);
+                }
+                if (progress.status == Parse::Details::Status::full) {
+                    return Utily::Error { Code::ply_value_count, progress.offset, values_per_line };
+                }
+                if (chunk.miscounted_line != std::string_view::npos) {
+                    return Utily::Error { Code::ply_value_count, chunk.begin + chunk.miscounted_line, values_per_line };
+                }
+                if (progress.count != chunk.lines * values_per_line) {
+                    return Utily::Error { Code::ply_value_count, chunk.end, values_per_line };
+                }
+            }
+            return end;
+        }
+
+        auto parse_ascii(const std::string_view text, const Header& header, const Ply::Options& options, Ply::Mesh& mesh)
+            -> Utily::Result<void, Utily::Error> {
+            const auto convert_float = [](const char* first, const char* last, const char* readable_end, float& value) {
+                return Parse::Details::parse_float(first, last, readable_end, value);
+            };
+            const auto convert_index = [](const char* first, const char* last, const char* readable_end, uint32_t& value) {
+                return Parse::Details::parse_int(first, last, readable_end, value);
+            };
+
+            size_t offset = header.body_offset;
+            for (const Element& element : header.elements) {
+                if (element.name == "vertex") {
+                    const auto columns = position_columns(element);
+                    if (columns.has_error()) {
+                        return columns.error();
+                    }
+                    if (const auto fits = check_fits(element, mesh.positions, mesh.indices); fits.has_error()) {
+                        return fits.error();
+                    }
+                    const size_t values_per_line = element.properties.size();
+                    const auto [x, y, z] = columns.value();
+                    if (values_per_line == 3 && x == 0 && y == 1 && z == 2) {
+                        const auto end = parse_ascii_element(text, offset, element.count, 3, mesh.positions, options, convert_float);
+                        if (end.has_error()) {
+                            return end.error();
+                        }
+                        offset = end.value();
+                        continue;
+                    }
+                    // Other vertex properties are parsed alongside, then the positions are gathered from them.
+                    const size_t size = element.count * values_per_line;
+                    const auto values = std::make_unique_for_overwrite<float[]>(size);
+                    const auto end = parse_ascii_element(text, offset, element.count, values_per_line, std::span<float> { values.get(), size }, options, convert_float);
+                    if (end.has_error()) {
+                        return end.error();
+                    }
+                    for (size_t v = 0; v < element.count; ++v) {
+                        const float* line = values.get() + v * values_per_line;
+                        mesh.positions[v * 3 + 0] = line[x];
+                        mesh.positions[v * 3 + 1] = line[y];
+                        mesh.positions[v * 3 + 2] = line[z];
+                    }
+                    offset = end.value();
+                } else if (element.name == "face") {
+                    if (const auto fits = check_fits(element, mesh.positions, mesh.indices); fits.has_error()) {
+                        return fits.error();
+                    }
+                    // Each line is "3 a b c", the counts are parsed with the indices and checked after.
+                    const size_t size = element.count * 4;
+                    const auto values = std::make_unique_for_overwrite<uint32_t[]>(size);
+                    const auto end = parse_ascii_element(text, offset, element.count, 4, std::span<uint32_t> { values.get(), size }, options, convert_index);
+                    if (end.has_error()) {
+                        return end.error();
+                    }
+                    const size_t vertex_count = mesh.vertex_count();
+                    for (size_t f = 0; f < element.count; ++f) {
+                        const uint32_t* line = values.get() + f * 4;
+                        if (line[0] != 3) {
+                            return Utily::Error { Code::ply_unsupported, offset }.with_detail("non-triangle");
+                        }
+                        for (size_t k = 0; k < 3; ++k) {
+                            if (line[k + 1] >= vertex_count) {
+                                return Utily::Error { Code::ply_invalid_index, f, line[k + 1], vertex_count };
+                            }
+                            mesh.indices[f * 3 + k] = line[k + 1];
+                        }
+                    }
+                    offset = end.value();
+                } else {
+                    offset = skip_lines(text, offset, element.count);
+                }
+            }
+            return {};
+        }
+
+        auto parse_binary(const std::span<const uint8_t> data, const Header& header, Ply::Mesh& mesh)
+            -> Utily::Result<void, Utily::Error> {
+            size_t offset = header.body_offset;
+            const auto truncated = [&](const size_t needed) {
+                return Utily::Error { Code::ply_truncated, offset, needed, data.size() - offset };
+            };
+
+            for (const Element& element : header.elements) {
+                const bool has_lists = std::any_of(element.properties.begin(), element.properties.end(), [](const Property& p) { return p.count_type != Type::none; });
+                size_t stride = 0;
+                for (const Property& property : element.properties) {
+                    stride += size_of(property.type);
+                }
+
+                if (element.name == "vertex") {
+                    const auto columns = position_columns(element);
+                    if (columns.has_error()) {
+                        return columns.error();
+                    }
+                    if (const auto fits = check_fits(element, mesh.positions, mesh.indices); fits.has_error()) {
+                        return fits.error();
+                    }
+                    if (element.count > (data.size() - offset) / stride) {
+                        return truncated(element.count * stride);
+                    }
+                    std::array<size_t, 3> column_offsets;
+                    std::array<Type, 3> column_types;
+                    for (size_t axis = 0; axis < 3; ++axis) {
+                        const size_t column = columns.value()[axis];
+                        column_types[axis] = element.properties[column].type;
+                        column_offsets[axis] = 0;
+                        for (size_t p = 0; p < column; ++p) {
+                            column_offsets[axis] += size_of(element.properties[p].type);
+                        }
+                    }
+                    const uint8_t* records = data.data() + offset;
+                    const bool is_packed = stride == 12 && column_offsets == std::array<size_t, 3> { 0, 4, 8 }
+                        && column_types == std::array<Type, 3> { Type::float32, Type::float32, Type::float32 };
+                    if (is_packed) {
+                        std::memcpy(mesh.positions.data(), records, element.count * stride);
+                    } else {
+                        for (size_t v = 0; v < element.count; ++v) {
+                            for (size_t axis = 0; axis < 3; ++axis) {
+                                mesh.positions[v * 3 + axis] = read_as<float>(column_types[axis], records + v * stride + column_offsets[axis]);
+                            }
+                        }
+                    }
+                    offset += element.count * stride;
+                } else if (element.name == "face") {
+                    if (const auto fits = check_fits(element, mesh.positions, mesh.indices); fits.has_error()) {
+                        return fits.error();
+                    }
+                    const Property& list = element.properties[0];
+                    const size_t count_size = size_of(list.count_type);
+                    const size_t index_size = size_of(list.type);
+                    const size_t record_size = count_size + 3 * index_size;
+                    const size_t vertex_count = mesh.vertex_count();
+                    for (size_t f = 0; f < element.count; ++f) {
+                        if (record_size > data.size() - offset) {
+                            return truncated(record_size);
+                        }
+                        const uint8_t* record = data.data() + offset;
+                        if (read_as<int64_t>(list.count_type, record) != 3) {
+                            return Utily::Error { Code::ply_unsupported, offset }.with_detail("non-triangle");
+                        }
+                        for (size_t k = 0; k < 3; ++k) {
+                            const auto index = read_as<int64_t>(list.type, record + count_size + k * index_size);
+                            if (index < 0 || static_cast<uint64_t>(index) >= vertex_count) {
+                                return Utily::Error { Code::ply_invalid_index, f, static_cast<uint64_t>(index), vertex_count };
+                            }
+                            mesh.indices[f * 3 + k] = static_cast<uint32_t>(index);
+                        }
+                        offset += record_size;
+                    }
+                } else if (!has_lists) {
+                    if (stride != 0 && element.count > (data.size() - offset) / stride) {
+                        return truncated(element.count * stride);
+                    }
+                    offset += element.count * stride;
+                } else {
+                    for (size_t i = 0; i < element.count; ++i) {
+                        for (const Property& property : element.properties) {
+                            size_t size = size_of(property.type);
+                            if (property.count_type != Type::none) {
+                                if (size_of(property.count_type) > data.size() - offset) {
+                                    return truncated(size_of(property.count_type));
+                                }
+                                const auto count = read_as<int64_t>(property.count_type, data.data() + offset);
+                                offset += size_of(property.count_type);
+                                size *= static_cast<size_t>(std::max(count, int64_t { 0 }));
+                            }
+                            if (size > data.size() - offset) {
+                                return truncated(size);
+                            }
+                            offset += size;
+                        }
+                    }
+                }
+            }
+            return {};
+        }
+    }
+
+    auto Ply::parse(std::span<const uint8_t> data, const Options& options)
+        -> Utily::Result<Mesh, Utily::Error> {
+        static_assert(std::endian::native == std::endian::little, "Binary PLY bodies are read in place");
+
+        const auto text = std::string_view { reinterpret_cast<const char*>(data.data()), data.size() };
+        auto header = parse_header(text);
+        if (header.has_error()) {
+            return header.error();
+        }
+
+        size_t vertex_count = 0;
+        size_t face_count = 0;
+        for (const Element& element : header.value().elements) {
+            if (element.name == "vertex") {
+                vertex_count = element.count;
+            } else if (element.name == "face") {
+                if (const auto checked = check_face(element); checked.has_error()) {
+                    return checked.error();
+                }
+                face_count = element.count;
+            }
+        }
+
+        // Every vertex and face takes at least a byte, so a count beyond that is refused before allocating.
+        const size_t body_size = data.size() - header.value().body_offset;
+        if (vertex_count > body_size || face_count > body_size) {
+            return Utily::Error { Code::ply_truncated, header.value().body_offset, std::max(vertex_count, face_count), body_size };
+        }
+
+        Mesh mesh;
+        std::tie(mesh.owner, mesh.positions, mesh.indices) = Utily::InlineArrays::alloc_uninit_aligned<Utily::InlineArrays::cache_line_size, float, uint32_t>(vertex_count * 3, face_count * 3);
+
+        const auto parsed = header.value().format == Format::ascii
+            ? parse_ascii(text, header.value(), options, mesh)
+            : parse_binary(data, header.value(), mesh);
+        if (parsed.has_error()) {
+            return parsed.error();
+        }
+        return mesh;
+    }
+
+    auto Ply::load(std::filesystem::path file_path, const Options& options)
+        -> Utily::Result<Mesh, Utily::Error> {
+        const auto file = Utily::FileReader::load_entire_file(file_path);
+        if (file.has_error()) {
+            return file.error();
+        }
+        return parse(file.value(), options);
+    }
+}
@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+
+#include "Utily/Error.hpp"
+#include "Utily/Result.hpp"
+
+#include <cerrno>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+using namespace std::literals;
+
+TEST(Error, Messages) {
+    static_assert(std::is_trivially_copyable_v<Utily::Error>);
+    static_assert(std::is_trivially_destructible_v<Utily::Result<uint32_t, Utily::Error>>);
+    static_assert(!std::is_constructible_v<Utily::Error, std::string&> && !std::is_constructible_v<Utily::Error, const std::string&>);
+    static_assert(!std::is_constructible_v<Utily::Error, std::string>);
+
+    constexpr Utily::Error literal { "Not good." };
+    static_assert(literal.code() == Utily::Error::Code::message);
+    EXPECT_EQ(literal.what(), "Not good."sv);
+    EXPECT_EQ(Utily::Error {}.what(), "Undefined error"sv);
+
+    using Code = Utily::Error::Code;
+    EXPECT_EQ(Utily::Error(Code::invalid_utf8, 12).what(), "Invalid UTF-8 at offset 12"sv);
+    EXPECT_EQ(Utily::Error(Code::too_many_floats, 40, 8).what(), "More than 8 floats, stopped at offset 40"sv);
+    EXPECT_EQ(Utily::Error(Code::file_read_failed, 0xbeef, 10, 20).what(), "File read failed after 10 of 20 bytes (path hash 0xbeef)"sv);
+    EXPECT_EQ(Utily::Error(Code::serialized_truncated, 16, 8, 3).what(), "Serialized data truncated, 8 bytes needed at offset 16 but 3 remain"sv);
+}
+
+TEST(Error, Payload) {
+    using Code = Utily::Error::Code;
+
+    auto error = Utily::Error { Code::file_open_failed, 0x1234 }.with_errno(ENOENT);
+    EXPECT_EQ(error.code(), Code::file_open_failed);
+    EXPECT_EQ(error.error_number(), ENOENT);
+    EXPECT_EQ(error.values()[0], 0x1234);
+    EXPECT_TRUE(error.what().starts_with("File could not be opened (path hash 0x1234): "));
+
+    auto token = Utily::Error { Code::invalid_integer, 3 }.with_detail("12x");
+    EXPECT_EQ(token.detail(), "12x"sv);
+    EXPECT_EQ(token.what(), "Invalid integer \"12x\" at offset 3"sv);
+
+    const auto long_token = std::string(Utily::Error::detail_capacity + 5, '9');
+    auto truncated = Utily::Error { Code::invalid_float, 0 }.with_detail(long_token);
+    EXPECT_EQ(truncated.detail(), long_token.substr(0, Utily::Error::detail_capacity));
+    EXPECT_EQ(truncated.what(), "Invalid float \"" + long_token.substr(0, Utily::Error::detail_capacity) + "...\" at offset 0");
+
+    // Static messages ignore details, they have nowhere to go.
+    auto message = Utily::Error { "static" }.with_detail("ignored");
+    EXPECT_EQ(message.what(), "static"sv);
+}
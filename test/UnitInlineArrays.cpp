@@ -1,6 +1,8 @@
 #include "Utily/Utily.hpp"
 
 #include <gtest/gtest.h>
+#include <numeric>
+#include <string>
 #include <vector>
 
 #if 0
@@ -122,4 +124,174 @@ TEST(InlineArrays, CopyRanges) {
     }
 }
 
-#endif
\ No newline at end of file
+#endif
+
+#if 1
+
+TEST(InlineArrays, Alignment) {
+    using Allocator = Utily::InlineArrays;
+    {
+        auto [owner, s1, s2, s3] = Allocator::alloc_uninit<char, Allocator::Aligned<float, 64>, Allocator::Aligned<int, Allocator::page_size>>(3, 5, 7);
+        EXPECT_TRUE(Allocator::is_aligned(s2.data(), 64));
+        EXPECT_TRUE(Allocator::is_aligned(s3.data(), Allocator::page_size));
+        EXPECT_EQ(s1.size(), 3);
+        EXPECT_EQ(s2.size(), 5);
+        EXPECT_EQ(s3.size(), 7);
+        EXPECT_LE(reinterpret_cast<std::byte*>(s1.data() + s1.size()), reinterpret_cast<std::byte*>(s2.data()));
+        EXPECT_LE(reinterpret_cast<std::byte*>(s2.data() + s2.size()), reinterpret_cast<std::byte*>(s3.data()));
+    }
+    {
+        auto [owner, s1, s2, s3] = Allocator::alloc_uninit_aligned<Allocator::cache_line_size, char, double, int>(1, 2, 3);
+        EXPECT_TRUE(Allocator::is_aligned(s1.data(), Allocator::cache_line_size));
+        EXPECT_TRUE(Allocator::is_aligned(s2.data(), Allocator::cache_line_size));
+        EXPECT_TRUE(Allocator::is_aligned(s3.data(), Allocator::cache_line_size));
+    }
+}
+
+TEST(InlineArrays, PaddedTail) {
+    using Allocator = Utily::InlineArrays;
+
+    auto [owner, s1, s2] = Allocator::alloc_uninit_padded<64, uint8_t, float>(3, 17);
+    EXPECT_EQ(s1.size(), 3);
+    EXPECT_EQ(s2.size(), 17);
+    EXPECT_TRUE(Allocator::is_aligned(s2.data(), 64));
+
+    // the tail up to the next vector boundary is addressable and zeroed.
+    const auto* tail1 = reinterpret_cast<const std::byte*>(s1.data() + s1.size());
+    const auto* tail2 = reinterpret_cast<const std::byte*>(s2.data() + s2.size());
+    EXPECT_TRUE(std::all_of(tail1, reinterpret_cast<const std::byte*>(s2.data()), [](std::byte b) { return b == std::byte { 0 }; }));
+    EXPECT_TRUE(std::all_of(tail2, tail2 + (64 - (s2.size_bytes() % 64)), [](std::byte b) { return b == std::byte { 0 }; }));
+}
+
+TEST(InlineArrays, BulkCopy) {
+    std::vector<float> a(100'003);
+    std::iota(a.begin(), a.end(), 0.0f);
+    std::vector<bool> b = { false, true, false, true };
+    std::vector<std::string> c = { "not", "trivially", "copyable" };
+
+    const auto options = Utily::InlineArrays::BulkCopy {
+        .non_temporal = true,
+        .max_threads = 4,
+        .min_bytes_per_thread = 1024
+    };
+    auto [data, s1, s2, s3] = Utily::InlineArrays::alloc_copy(options, a, b, c);
+
+    EXPECT_TRUE(std::ranges::equal(a, s1));
+    EXPECT_TRUE(std::ranges::equal(b, s2));
+    EXPECT_TRUE(std::ranges::equal(c, s3));
+    std::destroy(s3.begin(), s3.end());
+
+    auto [data2, s4] = Utily::InlineArrays::alloc_copy<Utily::InlineArrays::Aligned<float, 64>>(Utily::InlineArrays::BulkCopy {}, a);
+    EXPECT_TRUE(std::ranges::equal(a, s4));
+
+    // Many threads over odd sized arrays, so split points land inside jobs and on their edges.
+    std::vector<uint8_t> d(1001);
+    std::iota(d.begin(), d.end(), uint8_t { 0 });
+    std::vector<double> e(37, 0.5);
+    const auto many = Utily::InlineArrays::BulkCopy { .non_temporal = true, .max_threads = 13, .min_bytes_per_thread = 1 };
+    auto [data3, s5, s6, s7] = Utily::InlineArrays::alloc_copy(many, d, e, d);
+    EXPECT_TRUE(std::ranges::equal(d, s5));
+    EXPECT_TRUE(std::ranges::equal(e, s6));
+    EXPECT_TRUE(std::ranges::equal(d, s7));
+}
+
+TEST(InlineArrays, Block) {
+    using Allocator = Utily::InlineArrays;
+
+    Allocator::Block<Allocator::Aligned<float, 64>, uint32_t, char> block;
+    EXPECT_EQ(block.size<0>(), 0);
+    EXPECT_EQ(block.capacity<0>(), 0);
+
+    for (uint32_t i = 0; i < 1000; ++i) {
+        block.push_back<0>(static_cast<float>(i));
+        if (i % 3 == 0) {
+            block.emplace_back<1>(i);
+        }
+    }
+    const auto extra = std::to_array<uint32_t>({ 7, 8, 9 });
+    block.append<1>(extra);
+
+    EXPECT_EQ(block.size<0>(), 1000);
+    EXPECT_EQ(block.size<1>(), 337);
+    EXPECT_EQ(block.size<2>(), 0);
+    EXPECT_GE(block.capacity<0>(), 1000);
+    EXPECT_TRUE(Allocator::is_aligned(block.span<0>().data(), 64));
+
+    block.resize(1000, 337, 5);
+    EXPECT_TRUE(std::ranges::all_of(block.span<2>(), [](char c) { return c == 0; }));
+
+    auto [owner, floats, ints, chars] = block.freeze();
+    EXPECT_EQ(block.size<0>(), 0);
+    EXPECT_EQ(floats.size(), 1000);
+    EXPECT_EQ(ints.size(), 337);
+    EXPECT_EQ(chars.size(), 5);
+    EXPECT_TRUE(Allocator::is_aligned(floats.data(), 64));
+    for (size_t i = 0; i < floats.size(); ++i) {
+        EXPECT_EQ(floats[i], static_cast<float>(i));
+    }
+    for (size_t i = 0; i < 334; ++i) {
+        EXPECT_EQ(ints[i], i * 3);
+    }
+    EXPECT_TRUE(std::ranges::equal(ints.last(3), extra));
+
+    // empty blocks still freeze into valid spans.
+    auto [owner2, empty] = Allocator::Block<int> {}.freeze();
+    EXPECT_TRUE(empty.empty());
+}
+
+TEST(InlineArrays, BlockMovedFrom) {
+    using Allocator = Utily::InlineArrays;
+
+    Allocator::Block<int, double> source;
+    for (int i = 0; i < 4; ++i) {
+        source.push_back<0>(i);
+    }
+    Allocator::Block<int, double> moved { std::move(source) };
+    EXPECT_EQ(source.size<0>(), 0);
+    EXPECT_EQ(source.capacity<0>(), 0);
+
+    // The moved-from block grows its own buffer rather than writing into the other's.
+    source.push_back<0>(100);
+    source.push_back<1>(2.5);
+    EXPECT_TRUE(std::ranges::equal(moved.span<0>(), std::to_array({ 0, 1, 2, 3 })));
+
+    Allocator::Block<int, double> assigned;
+    assigned.push_back<1>(1.0);
+    assigned = std::move(moved);
+    moved.push_back<0>(-1);
+    EXPECT_TRUE(std::ranges::equal(assigned.span<0>(), std::to_array({ 0, 1, 2, 3 })));
+    EXPECT_TRUE(assigned.span<1>().empty());
+
+    auto [owner, ints, doubles] = source.freeze();
+    EXPECT_TRUE(std::ranges::equal(ints, std::to_array({ 100 })));
+    EXPECT_TRUE(std::ranges::equal(doubles, std::to_array({ 2.5 })));
+    auto [moved_owner, moved_ints, moved_doubles] = moved.freeze();
+    EXPECT_TRUE(std::ranges::equal(moved_ints, std::to_array({ -1 })));
+    EXPECT_TRUE(moved_doubles.empty());
+}
+
+
+TEST(InlineArrays, BlockPaddedTail) {
+    using Allocator = Utily::InlineArrays;
+
+    // Fill the capacity with non-zero values, then keep fewer so stale bytes sit in the padding.
+    Allocator::Block<Allocator::Padded<float, 64>, uint8_t> block;
+    for (int i = 0; i < 16; ++i) {
+        block.push_back<0>(1.0f);
+        block.push_back<1>(uint8_t { 0xFF });
+    }
+    block.clear();
+    for (int i = 0; i < 3; ++i) {
+        block.push_back<0>(2.0f);
+    }
+    block.push_back<1>(uint8_t { 7 });
+
+    auto [owner, floats, bytes] = block.freeze();
+    EXPECT_TRUE(std::ranges::equal(floats, std::to_array({ 2.0f, 2.0f, 2.0f })));
+    EXPECT_TRUE(Allocator::is_aligned(floats.data(), 64));
+    const auto* tail = reinterpret_cast<const std::byte*>(floats.data() + floats.size());
+    EXPECT_TRUE(std::all_of(tail, tail + (64 - floats.size_bytes()), [](std::byte b) { return b == std::byte { 0 }; }));
+    EXPECT_EQ(bytes[0], 7);
+}
+
+#endif
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include "Utily/MultiSearch.hpp"
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std::literals;
+
+namespace {
+    auto naive_find_all(std::string_view text, std::span<const std::string_view> patterns) -> std::vector<Utily::MultiSearch::Match> {
+        std::vector<Utily::MultiSearch::Match> matches;
+        for (size_t offset = 0; offset < text.size(); ++offset) {
+            for (size_t id = 0; id < patterns.size(); ++id) {
+                if (!patterns[id].empty() && text.substr(offset).starts_with(patterns[id])) {
+                    matches.push_back({ id, offset });
+                }
+            }
+        }
+        return matches;
+    }
+
+    constexpr auto ENGINES = std::to_array({
+        Utily::MultiSearch::Engine::teddy,
+        Utily::MultiSearch::Engine::aho_corasick,
+    });
+}
+
+TEST(MultiSearch, Basic) {
+    const auto text = "error: disk full; warning: retrying; error: giving up"sv;
+    for (const auto engine : ENGINES) {
+        const auto searcher = Utily::MultiSearch({ "error"sv, "warning"sv, "up"sv }, engine);
+        EXPECT_EQ(searcher.engine(), engine);
+        EXPECT_EQ(searcher.pattern_count(), 3);
+        EXPECT_EQ(searcher.pattern(1), "warning"sv);
+
+        const auto matches = searcher.find_all(text);
+        const auto expected = std::vector<Utily::MultiSearch::Match> {
+            { 0, 0 },
+            { 1, 18 },
+            { 0, 37 },
+            { 2, 51 },
+        };
+        EXPECT_EQ(matches, expected);
+        EXPECT_TRUE(searcher.find_all(""sv).empty());
+    }
+    EXPECT_EQ(Utily::MultiSearch({ "error"sv, "warning"sv }).engine(), Utily::MultiSearch::Engine::teddy);
+}
+
+TEST(MultiSearch, OverlappingAndNested) {
+    const auto patterns = std::to_array({ "he"sv, "she"sv, "his"sv, "hers"sv, ""sv, "h"sv });
+    const auto text = "ushershishe"sv;
+    for (const auto engine : ENGINES) {
+        const auto searcher = Utily::MultiSearch(patterns, engine);
+        EXPECT_EQ(searcher.find_all(text), naive_find_all(text, patterns));
+    }
+}
+
+TEST(MultiSearch, MatchesNaive) {
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> letter('a', 'd');
+    std::uniform_int_distribution<size_t> length(1, 6);
+
+    for (const size_t pattern_count : std::to_array<size_t>({ 1, 3, 8, 20, 32, 100 })) {
+        std::vector<std::string> owned(pattern_count);
+        for (auto& pattern : owned) {
+            pattern.resize(length(gen));
+            std::ranges::generate(pattern, [&] { return static_cast<char>(letter(gen)); });
+        }
+        const auto patterns = std::vector<std::string_view>(owned.begin(), owned.end());
+
+        // Lengths either side of the 16 byte vector and its tail.
+        for (const size_t text_size : std::to_array<size_t>({ 0, 5, 15, 16, 17, 18, 31, 200, 1000 })) {
+            std::string text(text_size, ' ');
+            std::ranges::generate(text, [&] { return static_cast<char>(letter(gen)); });
+
+            const auto expected = naive_find_all(text, patterns);
+            for (const auto engine : ENGINES) {
+                const auto searcher = Utily::MultiSearch(patterns, engine);
+                EXPECT_EQ(searcher.find_all(text), expected) << pattern_count << " patterns, text of " << text_size;
+            }
+            EXPECT_EQ(Utily::MultiSearch(patterns).find_all(text), expected);
+        }
+    }
+}
+
+TEST(MultiSearch, HighBytes) {
+    const auto patterns = std::to_array({ "\xff\x80"sv, "\x7f\xff"sv, "\x00\x01"sv });
+    const auto text = "\x7f\xff\x80\x00\x01\xff\x80"sv;
+    for (const auto engine : ENGINES) {
+        const auto searcher = Utily::MultiSearch(patterns, engine);
+        EXPECT_EQ(searcher.find_all(text), naive_find_all(text, patterns));
+        EXPECT_EQ(searcher.find_all(text).size(), 4);
+    }
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include "Utily/Parse.hpp"
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std::literals;
+
+TEST(Parse, ints) {
+    std::array<int32_t, 8> out {};
+    auto result = Utily::parse_ints("1 -22  333\n+4444\r\n-2147483648 2147483647 0"sv, ' ', std::span { out });
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), 7);
+    EXPECT_EQ(out, (std::array<int32_t, 8> { 1, -22, 333, 4444, -2147483648, 2147483647, 0, 0 }));
+
+    std::array<uint8_t, 4> bytes {};
+    EXPECT_EQ(Utily::parse_ints(",255,,0,"sv, ',', std::span { bytes }).value(), 2);
+    EXPECT_EQ(Utily::parse_ints("256"sv, ',', std::span { bytes }).error().what(), "Invalid integer \"256\" at offset 0"sv);
+    EXPECT_EQ(Utily::parse_ints("1,-1"sv, ',', std::span { bytes }).error().what(), "Invalid integer \"-1\" at offset 2"sv);
+    EXPECT_EQ(Utily::parse_ints("1,2x,3"sv, ',', std::span { bytes }).error().what(), "Invalid integer \"2x\" at offset 2"sv);
+    EXPECT_EQ(Utily::parse_ints("1,2,3,4,5"sv, ',', std::span { bytes }).error().what(), "More than 4 integers, stopped at offset 8"sv);
+    EXPECT_EQ(Utily::parse_ints(""sv, ',', std::span { bytes }).value(), 0);
+
+    std::array<int64_t, 3> longs {};
+    EXPECT_EQ(Utily::parse_ints("-9223372036854775808 9223372036854775807 1234567890123456"sv, ' ', std::span { longs }).value(), 3);
+    EXPECT_EQ(longs[0], std::numeric_limits<int64_t>::min());
+    EXPECT_EQ(longs[1], std::numeric_limits<int64_t>::max());
+    EXPECT_EQ(longs[2], 1234567890123456);
+    EXPECT_TRUE(Utily::parse_ints("9223372036854775808"sv, ' ', std::span { longs }).has_error());
+}
+
+TEST(Parse, floats) {
+    std::array<float, 8> out {};
+    auto result = Utily::parse_floats("-0.0378297 0.12794 1e3 \n.5 -2.5E-3 inf 7."sv, ' ', std::span { out });
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), 7);
+    EXPECT_EQ(out[0], -0.0378297f);
+    EXPECT_EQ(out[1], 0.12794f);
+    EXPECT_EQ(out[2], 1000.0f);
+    EXPECT_EQ(out[3], 0.5f);
+    EXPECT_EQ(out[4], -2.5e-3f);
+    EXPECT_EQ(out[5], std::numeric_limits<float>::infinity());
+    EXPECT_EQ(out[6], 7.0f);
+
+    EXPECT_EQ(Utily::parse_floats("1.0 1.2.3"sv, ' ', std::span { out }).error().what(), "Invalid float \"1.2.3\" at offset 4"sv);
+    EXPECT_TRUE(Utily::parse_floats("1e"sv, ' ', std::span { out }).has_error());
+    EXPECT_TRUE(Utily::parse_floats("-"sv, ' ', std::span { out }).has_error());
+}
+
+TEST(Parse, matches_from_chars) {
+    std::mt19937_64 gen(11);
+    std::uniform_real_distribution<double> dist(-1e4, 1e4);
+    std::uniform_int_distribution<int> exponents(-30, 30); // within float range.
+
+    std::string text;
+    std::vector<std::string> tokens;
+    for (size_t i = 0; i < 5000; ++i) {
+        std::array<char, 64> buffer;
+        const double value = dist(gen) * (i % 3 == 0 ? std::pow(10.0, exponents(gen)) : 1.0);
+        const auto format = i % 2 ? std::chars_format::general : std::chars_format::scientific;
+        const auto end = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value, format, static_cast<int>(i % 18) + 1).ptr;
+        tokens.emplace_back(buffer.data(), end);
+        text += tokens.back();
+        text += (i % 7 == 0) ? "\n" : ",";
+    }
+
+    std::vector<double> doubles(tokens.size());
+    std::vector<float> floats(tokens.size());
+    ASSERT_EQ(Utily::parse_floats(text, ',', std::span { doubles }).value(), tokens.size());
+    ASSERT_EQ(Utily::parse_floats(text, ',', std::span { floats }).value(), tokens.size());
+    for (size_t i = 0; i < tokens.size(); ++i) {
+        double expected_double;
+        float expected_float;
+        std::from_chars(tokens[i].data(), tokens[i].data() + tokens[i].size(), expected_double);
+        std::from_chars(tokens[i].data(), tokens[i].data() + tokens[i].size(), expected_float);
+        EXPECT_EQ(doubles[i], expected_double) << tokens[i];
+        EXPECT_EQ(floats[i], expected_float) << tokens[i];
+    }
+}
+
+TEST(Parse, type_erased_vector) {
+    std::string text;
+    for (int32_t i = -5000; i < 5000; ++i) {
+        text += std::to_string(i) + (i % 10 == 0 ? "\n" : " ");
+    }
+    Utily::TypeErasedVector out { int32_t {} };
+    out.push_back(int32_t { 42 });
+    auto result = Utily::parse_ints<int32_t>(text, ' ', out);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), 10000);
+    ASSERT_EQ(out.size(), 10001);
+    const auto values = out.as_span<int32_t>();
+    EXPECT_EQ(values[0], 42);
+    for (size_t i = 1; i < values.size(); ++i) {
+        EXPECT_EQ(values[i], static_cast<int32_t>(i) - 5001);
+    }
+
+    Utily::TypeErasedVector floats { float {} };
+    EXPECT_EQ(Utily::parse_floats<float>(text + " x", ' ', floats).error().what(), "Invalid float \"x\" at offset " + std::to_string(text.size() + 1));
+    EXPECT_EQ(floats.size(), 10000);
+}
@@ -0,0 +1,166 @@
+#include "Utily/Utily.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+    const auto STANFORD_BUNNY_PATH = std::filesystem::path { "resources/stanford_bunny.ply" };
+
+    auto as_bytes(const std::string_view text) -> std::span<const uint8_t> {
+        return { reinterpret_cast<const uint8_t*>(text.data()), text.size() };
+    }
+
+    template <typename T>
+    void append(std::string& out, const T value) {
+        out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+}
+
+TEST(Ply, StanfordBunny) {
+    auto result = Utily::Ply::load(STANFORD_BUNNY_PATH);
+    ASSERT_TRUE(result.has_value()) << result.error().what();
+    const auto& mesh = result.value();
+
+    EXPECT_EQ(mesh.vertex_count(), 35947);
+    EXPECT_EQ(mesh.triangle_count(), 69451);
+    EXPECT_FLOAT_EQ(mesh.positions[0], -0.0378297f);
+    EXPECT_FLOAT_EQ(mesh.positions[1], 0.12794f);
+    EXPECT_FLOAT_EQ(mesh.positions[2], 0.00447467f);
+    EXPECT_EQ(mesh.indices[0], 21216);
+    EXPECT_EQ(mesh.indices[1], 21215);
+    EXPECT_EQ(mesh.indices[2], 20399);
+    EXPECT_EQ(mesh.indices.back(), 17345);
+    EXPECT_TRUE(Utily::InlineArrays::is_aligned(mesh.indices.data(), Utily::InlineArrays::cache_line_size));
+
+    // Split into many small chunks, the result must not change.
+    auto threaded = Utily::Ply::load(STANFORD_BUNNY_PATH, { .max_threads = 7, .min_bytes_per_thread = 1024 });
+    ASSERT_TRUE(threaded.has_value()) << threaded.error().what();
+    EXPECT_TRUE(std::ranges::equal(threaded.value().positions, mesh.positions));
+    EXPECT_TRUE(std::ranges::equal(threaded.value().indices, mesh.indices));
+}
+
+TEST(Ply, AsciiAndBinary) {
+    {
+        const std::string_view text = "ply\r\n"
+                                      "format ascii 1.0\r\n"
+                                      "comment made by hand\r\n"
+                                      "element vertex 3\r\n"
+                                      "property uchar red\r\n"
+                                      "property float z\r\n"
+                                      "property float y\r\n"
+                                      "property float x\r\n"
+                                      "element edge 1\r\n"
+                                      "property int vertex1\r\n"
+                                      "property int vertex2\r\n"
+                                      "element face 1\r\n"
+                                      "property list uchar int vertex_indices\r\n"
+                                      "end_header\r\n"
+                                      "255 3 2 1\r\n"
+                                      "0 -6 5e-1 4.0\r\n"
+                                      "7 9 8 7\r\n"
+                                      "0 1\r\n"
+                                      "3 2 1 0";
+        auto result = Utily::Ply::parse(as_bytes(text));
+        ASSERT_TRUE(result.has_value()) << result.error().what();
+        EXPECT_TRUE(std::ranges::equal(result.value().positions, std::vector<float> { 1, 2, 3, 4, 0.5f, -6, 7, 8, 9 }));
+        EXPECT_TRUE(std::ranges::equal(result.value().indices, std::vector<uint32_t> { 2, 1, 0 }));
+    }
+    {
+        std::string data = "ply\n"
+                           "format binary_little_endian 1.0\n"
+                           "element vertex 2\n"
+                           "property double x\n"
+                           "property double y\n"
+                           "property double z\n"
+                           "property uchar flags\n"
+                           "element material 1\n"
+                           "property list uchar float weights\n"
+                           "element face 2\n"
+                           "property list uchar uint vertex_indices\n"
+                           "end_header\n";
+        for (const double value : { 1.5, -2.0, 3.25 }) {
+            append(data, value);
+        }
+        append(data, uint8_t { 1 });
+        for (const double value : { 4.0, 5.0, 6.0 }) {
+            append(data, value);
+        }
+        append(data, uint8_t { 2 });
+        append(data, uint8_t { 2 });
+        append(data, 0.5f);
+        append(data, 0.25f);
+        append(data, uint8_t { 3 });
+        append(data, uint32_t { 0 });
+        append(data, uint32_t { 1 });
+        append(data, uint32_t { 1 });
+        append(data, uint8_t { 3 });
+        append(data, uint32_t { 1 });
+        append(data, uint32_t { 0 });
+        append(data, uint32_t { 0 });
+
+        auto result = Utily::Ply::parse(as_bytes(data));
+        ASSERT_TRUE(result.has_value()) << result.error().what();
+        EXPECT_TRUE(std::ranges::equal(result.value().positions, std::vector<float> { 1.5f, -2, 3.25f, 4, 5, 6 }));
+        EXPECT_TRUE(std::ranges::equal(result.value().indices, std::vector<uint32_t> { 0, 1, 1, 1, 0, 0 }));
+
+        data.pop_back();
+        auto truncated = Utily::Ply::parse(as_bytes(data));
+        ASSERT_TRUE(truncated.has_error());
+        EXPECT_EQ(truncated.error().code(), Utily::Error::Code::ply_truncated);
+    }
+}
+
+TEST(Ply, Errors) {
+    using Code = Utily::Error::Code;
+    const auto error_of = [](const std::string_view text) {
+        auto result = Utily::Ply::parse(as_bytes(text));
+        EXPECT_TRUE(result.has_error());
+        return result.has_error() ? result.error() : Utily::Error {};
+    };
+    const std::string_view header = "ply\nformat ascii 1.0\nelement vertex 3\nproperty float x\nproperty float y\nproperty float z\n"
+                                    "element face 1\nproperty list uchar int vertex_indices\nend_header\n";
+
+    EXPECT_EQ(error_of("plx\n").code(), Code::ply_invalid_header);
+    EXPECT_EQ(error_of("ply\nformat ascii 1.0\nelement vertex\nend_header\n").detail(), "element vertex");
+    EXPECT_EQ(error_of("ply\nformat binary_big_endian 1.0\nend_header\n").code(), Code::ply_unsupported);
+    EXPECT_EQ(error_of("ply\nformat ascii 1.0\nelement vertex 1\nproperty float x\nend_header\n0\n").code(), Code::ply_unsupported);
+    EXPECT_EQ(error_of("ply\nformat ascii 1.0\nend_header").code(), Code::ply_invalid_header);
+
+    const auto body = [&](const std::string_view lines) { return std::string { header } + std::string { lines }; };
+    EXPECT_EQ(error_of(body("0 0 0\n1 1 1\n2 2 2\n4 0 1 2 0\n")).code(), Code::ply_value_count);
+    EXPECT_EQ(error_of(body("0 0 0\n1 1 1\n2 2 2\n4 0 1 2\n")).code(), Code::ply_unsupported);
+    EXPECT_EQ(error_of(body("0 0 0\n1 1\n2 2 2\n3 0 1 2\n")).code(), Code::ply_value_count);
+
+    // The right number of values overall, but not on each line.
+    const auto shifted = error_of(body("0 0 0\n1 1\n2 2 2 2\n3 0 1 2\n"));
+    EXPECT_EQ(shifted.code(), Code::ply_value_count);
+    EXPECT_EQ(shifted.values()[0], header.size() + 6);
+    EXPECT_EQ(error_of(body("0 0 0\n1 1 1\n2 2 2\n3 0 1\n2\n")).code(), Code::ply_value_count);
+
+    // A second vertex or face element would be written past the arrays sized from the first.
+    const std::string_view xyz = "property float x\nproperty float y\nproperty float z\n";
+    std::string repeated = "ply\nformat binary_little_endian 1.0\nelement vertex 64\n" + std::string { xyz } + "element vertex 1\n" + std::string { xyz } + "end_header\n";
+    repeated.append(65 * 3 * sizeof(float), '\0');
+    const auto repeated_vertex = error_of(repeated);
+    EXPECT_EQ(repeated_vertex.code(), Code::ply_invalid_header);
+    EXPECT_TRUE(repeated_vertex.detail().starts_with("element vertex"));
+    EXPECT_EQ(error_of(std::string { header.substr(0, header.size() - 11) } + "element face 2\nproperty list uchar int vertex_indices\nend_header\n").code(), Code::ply_invalid_header);
+
+    const auto invalid_float = error_of(body("0 0 0\n1 x 1\n2 2 2\n3 0 1 2\n"));
+    EXPECT_EQ(invalid_float.code(), Code::invalid_float);
+    EXPECT_EQ(invalid_float.values()[0], header.size() + 8);
+
+    const auto invalid_index = error_of(body("0 0 0\n1 1 1\n2 2 2\n3 0 1 3\n"));
+    EXPECT_EQ(invalid_index.code(), Code::ply_invalid_index);
+    EXPECT_EQ(invalid_index.what(), "PLY face 0 has index 3 but there are 3 vertices");
+
+    EXPECT_EQ(Utily::Ply::load("resources/missing.ply").error().code(), Code::file_not_found);
+}
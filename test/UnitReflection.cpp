@@ -2,6 +2,15 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
 #if 0
 
 TEST(Reflection, BaseTypes) {
@@ -24,4 +33,180 @@ TEST(Reflection, BaseTypes) {
     }
 }
 
-#endif
\ No newline at end of file
+#endif
+namespace {
+    struct Vertex {
+        float x;
+        float y;
+        float z;
+        uint8_t flags;
+        double weight;
+        std::array<int16_t, 3> normal;
+    };
+
+    struct Named {
+        std::string name;
+        Vertex vertex;
+        std::vector<int> indices;
+    };
+
+    struct Empty { };
+
+    // Offsets the natural layout rules would get wrong.
+    struct Aligned {
+        char a;
+        alignas(8) float f;
+        bool b;
+        alignas(2) char c;
+        Vertex inner;
+    };
+
+    enum class Level : int8_t {
+        trace = -2,
+        debug,
+        info,
+        warn = 10,
+        error,
+    };
+
+    enum Channel {
+        red,
+        green,
+        blue,
+    };
+
+    enum class Axis : uint8_t {
+        x,
+        yz,
+        xyzw,
+        a_rather_long_axis_name,
+    };
+
+    // Same length, first and last 8 bytes, which no hash seed can separate.
+    enum class Lookalike {
+        prefix__A__suffix_,
+        prefix__B__suffix_,
+    };
+}
+
+TEST(Reflection, FieldIntrospection) {
+    using R = Utily::Reflection;
+    static_assert(R::field_count<Vertex> == 6);
+    static_assert(R::field_count<Named> == 3);
+    static_assert(R::field_count<Empty> == 0);
+
+    static_assert(std::same_as<R::field_type<Vertex, 3>, uint8_t>);
+    static_assert(std::same_as<R::field_type<Named, 1>, Vertex>);
+
+    static_assert(R::get_field_offset<Vertex, 0>() == offsetof(Vertex, x));
+    static_assert(R::get_field_offset<Vertex, 3>() == offsetof(Vertex, flags));
+    static_assert(R::get_field_offset<Vertex, 4>() == offsetof(Vertex, weight));
+    static_assert(R::get_field_offset<Vertex, 5>() == offsetof(Vertex, normal));
+    static_assert(R::get_field_offset<Aligned, 1>() == offsetof(Aligned, f));
+    static_assert(R::get_field_offset<Aligned, 2>() == offsetof(Aligned, b));
+    static_assert(R::get_field_offset<Aligned, 3>() == offsetof(Aligned, c));
+    static_assert(R::get_field_offset<Aligned, 4>() == offsetof(Aligned, inner));
+
+    static_assert(R::get_field_name<Vertex, 0>() == "x");
+    static_assert(R::get_field_name<Vertex, 4>() == "weight");
+    static_assert(R::get_field_name<Named, 2>() == "indices");
+}
+
+TEST(Reflection, ForEachField) {
+    Vertex vertex { 1.0f, 2.0f, 3.0f, 4, 5.0, { 6, 7, 8 } };
+    double sum = 0;
+    Utily::Reflection::for_each_field(vertex, [&](auto& field) {
+        if constexpr (std::is_arithmetic_v<std::remove_cvref_t<decltype(field)>>) {
+            sum += static_cast<double>(field);
+            field = {};
+        }
+    });
+    EXPECT_EQ(sum, 15.0);
+    EXPECT_EQ(vertex.weight, 0.0);
+    EXPECT_EQ(vertex.normal[2], 8);
+
+    const Named named { "bunny", vertex, { 1, 2 } };
+    std::string names;
+    Utily::Reflection::for_each_named_field(named, [&](std::string_view name, const auto&) {
+        names += std::string { name } + ",";
+    });
+    EXPECT_EQ(names, "name,vertex,indices,");
+}
+
+TEST(Reflection, TypeId) {
+    using R = Utily::Reflection;
+    static_assert(R::get_type_id<Vertex>() == R::get_type_id<Vertex>());
+    static_assert(R::get_type_id<Vertex>() != R::get_type_id<Named>());
+    static_assert(R::get_type_id<float>() != R::get_type_id<double>());
+    static_assert(R::get_type_id<int32_t>() != R::get_type_id<uint32_t>());
+    static_assert(R::get_type_id<int32_t>() != 0);
+    // The whole spelling is hashed, not just its first word.
+    static_assert(R::get_type_id<uint64_t>() != R::get_type_id<int64_t>());
+    static_assert(R::get_type_id<unsigned char>() != R::get_type_id<unsigned int>());
+    static_assert(R::get_type_id<std::pair<int, float>>() != R::get_type_id<std::pair<int, double>>());
+    static_assert(R::get_type_id<std::array<int, 3>>() != R::get_type_id<std::array<int, 4>>());
+    static_assert(R::get_type_id<int (*)(int)>() != R::get_type_id<int (*)(float)>());
+    static_assert(R::get_type_id<unsigned long>() == R::get_type_id<long unsigned int>());
+    static_assert(R::get_type_name<std::pair<int, float>>().ends_with("pair<int, float>"));
+
+    // The same type printed by different compilers hashes the same.
+    using Utily::ReflectionDetails::hash_type_name;
+    static_assert(hash_type_name("long unsigned int") == hash_type_name("unsigned long"));
+    static_assert(hash_type_name("unsigned __int64") == hash_type_name("long long unsigned int"));
+    static_assert(hash_type_name("short int") == hash_type_name("short"));
+    static_assert(hash_type_name("signed char") != hash_type_name("char"));
+    static_assert(hash_type_name("struct Foo::Bar") == hash_type_name("Foo::Bar"));
+    static_assert(hash_type_name("std::pair<int,class Foo>") == hash_type_name("std::pair<int, Foo>"));
+    static_assert(hash_type_name("const Foo *") == hash_type_name("const Foo*"));
+    static_assert(hash_type_name("long double") != hash_type_name("double"));
+
+    constexpr auto info = R::get_type_info<Vertex>();
+    static_assert(info.id == R::get_type_id<Vertex>());
+    static_assert(info.size == sizeof(Vertex) && info.alignment == alignof(Vertex));
+    static_assert(info.is_trivially_copyable && info.is_trivially_destructible);
+    static_assert(!R::get_type_info<Named>().is_trivially_copyable);
+    EXPECT_TRUE(info.name.ends_with("Vertex"));
+}
+
+TEST(Reflection, Enums) {
+    using R = Utily::Reflection;
+    static_assert(R::enum_values<Level>().size() == 5);
+    static_assert(R::enum_values<Level>()[0] == Level::trace);
+    static_assert(R::enum_values<Level>()[4] == Level::error);
+    static_assert(R::enum_name(Level::warn) == "warn");
+    static_assert(R::enum_name(Channel::blue) == "blue");
+    static_assert(R::enum_from_string<Level>("debug") == Level::debug);
+
+    EXPECT_EQ(R::enum_name(Level::trace), "trace");
+    EXPECT_EQ(R::enum_name(Level::error), "error");
+    EXPECT_EQ(R::enum_name(static_cast<Level>(5)), "");
+    EXPECT_EQ(R::enum_name(Channel::green), "green");
+    EXPECT_EQ(R::enum_name(static_cast<Channel>(3)), "");
+    EXPECT_EQ(R::enum_name(Utily::Error::Code::invalid_utf8), "invalid_utf8");
+
+    EXPECT_EQ(R::enum_from_string<Level>("info"), Level::info);
+    EXPECT_EQ(R::enum_from_string<Level>("error"), Level::error);
+    EXPECT_EQ(R::enum_from_string<Level>("Error"), std::nullopt);
+    EXPECT_EQ(R::enum_from_string<Level>(""), std::nullopt);
+    EXPECT_EQ(R::enum_from_string<Channel>("red"), Channel::red);
+
+    // The codes count up from zero, so none between the first and the last were missed.
+    const auto& codes = R::enum_values<Utily::Error::Code>();
+    for (const auto code : codes) {
+        EXPECT_EQ(R::enum_from_string<Utily::Error::Code>(R::enum_name(code)), code);
+    }
+    EXPECT_EQ(codes.size(), static_cast<size_t>(codes.back()) + 1);
+
+    // Every name length goes through a different path of the string hash.
+    for (const auto axis : R::enum_values<Axis>()) {
+        const std::string name { R::enum_name(axis) };
+        EXPECT_EQ(R::enum_from_string<Axis>(name), axis);
+        EXPECT_EQ(R::enum_from_string<Axis>(name + "_"), std::nullopt);
+        EXPECT_EQ(R::enum_from_string<Axis>(name.substr(1)), std::nullopt);
+    }
+    EXPECT_EQ(R::enum_from_string<Axis>("a_rather_long_?xis_name"), std::nullopt);
+
+    static_assert(!Utily::ReflectionDetails::enum_name_table<Lookalike>.is_perfect);
+    EXPECT_EQ(R::enum_from_string<Lookalike>(std::string { "prefix__B__suffix_" }), Lookalike::prefix__B__suffix_);
+    EXPECT_EQ(R::enum_from_string<Lookalike>(std::string { "prefix__C__suffix_" }), std::nullopt);
+}
@@ -2,11 +2,32 @@
 
 #include "Utily/Result.hpp"
 
+#include <cstdint>
 #include <memory>
+#include <stdexcept>
+#include <string>
 #include <string_view>
 
 using namespace std::literals;
 
+namespace {
+    // Counts the live instances, copies throw while throw_on_copy is set.
+    struct Counted {
+        static inline int live = 0;
+        static inline bool throw_on_copy = false;
+
+        Counted() { ++live; }
+        Counted(const Counted&) {
+            if (throw_on_copy) {
+                throw std::runtime_error("copy");
+            }
+            ++live;
+        }
+        auto operator=(const Counted&) -> Counted& = default;
+        ~Counted() { --live; }
+    };
+}
+
 TEST(Result, Constructors) {
     { // Value move constructor
         Utily::Result<int, std::string_view> result { 1 };
@@ -72,6 +93,30 @@ TEST(Result, Constructors) {
     }
 }
 
+TEST(Result, AssignmentThrows) {
+    {
+        Utily::Result<Counted, int> a { Counted {} };
+        const Utily::Result<Counted, int> b { Counted {} };
+        Utily::Result<Counted, int> c { 3 };
+        EXPECT_EQ(Counted::live, 2);
+
+        // A failed copy leaves the target as it was, so nothing is destroyed twice.
+        Counted::throw_on_copy = true;
+        EXPECT_THROW(a = b, std::runtime_error);
+        EXPECT_THROW(c = b, std::runtime_error);
+        Counted::throw_on_copy = false;
+        EXPECT_TRUE(a.has_value());
+        ASSERT_TRUE(c.has_error());
+        EXPECT_EQ(c.error(), 3);
+        EXPECT_EQ(Counted::live, 2);
+
+        c = a;
+        EXPECT_TRUE(c.has_value());
+        EXPECT_EQ(Counted::live, 3);
+    }
+    EXPECT_EQ(Counted::live, 0);
+}
+
 TEST(Result, Handling) {
     constexpr static int not_handled = 0;
     constexpr static int handled_as_value = 1;
@@ -120,4 +165,85 @@ TEST(Result, Handling) {
         EXPECT_TRUE(result.has_error());
         EXPECT_EQ(result.error(), handled_as_error);
     }
-}
\ No newline at end of file
+}
+TEST(Result, Layout) {
+    enum class Code : uint8_t { bad };
+    static_assert(sizeof(Utily::Result<uint32_t, Code>) == 2 * sizeof(uint32_t));
+    static_assert(std::is_trivially_copyable_v<Utily::Result<uint32_t, Code>>);
+    static_assert(std::is_trivially_destructible_v<Utily::Result<uint32_t, Code>>);
+    static_assert(!std::is_trivially_copyable_v<Utily::Result<std::string, Code>>);
+    static_assert(!std::is_copy_constructible_v<Utily::Result<std::unique_ptr<int>, Code>>);
+    static_assert(std::is_nothrow_move_constructible_v<Utily::Result<std::unique_ptr<int>, Code>>);
+
+    { // Copies and moves carry the active member over
+        Utily::Result<std::string, int> value { std::string(100, 'v') };
+        Utily::Result<std::string, int> error { 7 };
+        auto copy = value;
+        EXPECT_EQ(copy.value(), std::string(100, 'v'));
+        copy = error;
+        ASSERT_TRUE(copy.has_error());
+        EXPECT_EQ(copy.error(), 7);
+        copy = std::move(value);
+        EXPECT_EQ(copy.value(), std::string(100, 'v'));
+    }
+    { // Move only
+        Utily::Result<std::unique_ptr<int>, std::string_view> result { std::make_unique<int>(3) };
+        auto moved = std::move(result);
+        EXPECT_EQ(*moved.value(), 3);
+        moved = Utily::Result<std::unique_ptr<int>, std::string_view> { "gone"sv };
+        EXPECT_EQ(moved.error(), "gone"sv);
+    }
+}
+
+TEST(Result, Monadic) {
+    using IntResult = Utily::Result<int, std::string_view>;
+    const auto half = [](int value) -> IntResult {
+        if (value % 2 != 0) {
+            return "odd"sv;
+        }
+        return value / 2;
+    };
+
+    { // and_then chains until the first error
+        EXPECT_EQ(IntResult { 8 }.and_then(half).and_then(half).value(), 2);
+        EXPECT_EQ(IntResult { 6 }.and_then(half).and_then(half).error(), "odd"sv);
+        EXPECT_EQ(IntResult { "bad"sv }.and_then(half).error(), "bad"sv);
+    }
+    { // transform and transform_error change one side
+        const IntResult value { 2 };
+        auto text = value.transform([](int v) { return std::to_string(v); });
+        static_assert(std::same_as<decltype(text), Utily::Result<std::string, std::string_view>>);
+        EXPECT_EQ(text.value(), "2");
+
+        auto length = IntResult { "error"sv }.transform_error([](std::string_view e) { return e.size(); });
+        static_assert(std::same_as<decltype(length), Utily::Result<int, size_t>>);
+        EXPECT_EQ(length.error(), 5);
+
+        int seen = 0;
+        auto nothing = IntResult { 3 }.transform([&](int v) { seen = v; });
+        static_assert(std::same_as<decltype(nothing), Utily::Result<void, std::string_view>>);
+        EXPECT_TRUE(nothing.has_value());
+        EXPECT_EQ(seen, 3);
+    }
+    { // or_else recovers, value_or falls back
+        EXPECT_EQ(IntResult { "bad"sv }.or_else([](std::string_view) -> IntResult { return 0; }).value(), 0);
+        EXPECT_EQ(IntResult { 4 }.or_else([](std::string_view) -> IntResult { return 0; }).value(), 4);
+        EXPECT_EQ(IntResult { "bad"sv }.value_or(-1), -1);
+        EXPECT_EQ(IntResult { 4 }.value_or(-1), 4);
+    }
+    { // Rvalues move through the chain
+        using PtrResult = Utily::Result<std::unique_ptr<int>, std::string_view>;
+        auto doubled = PtrResult { std::make_unique<int>(21) }
+                           .transform([](std::unique_ptr<int> p) { *p *= 2; return p; })
+                           .and_then([](std::unique_ptr<int> p) -> PtrResult { return p; });
+        EXPECT_EQ(*doubled.value(), 42);
+        EXPECT_EQ(*std::move(doubled).value_or(nullptr), 42);
+    }
+    { // void Results
+        using VoidResult = Utily::Result<void, std::string_view>;
+        EXPECT_EQ(VoidResult {}.and_then([] { return IntResult { 1 }; }).value(), 1);
+        EXPECT_EQ(VoidResult { "bad"sv }.transform([] { return 1; }).error(), "bad"sv);
+        EXPECT_EQ(VoidResult { "bad"sv }.transform_error([](std::string_view e) { return e.size(); }).error(), 3);
+        EXPECT_TRUE(VoidResult { "bad"sv }.or_else([](std::string_view) { return VoidResult {}; }).has_value());
+    }
+}
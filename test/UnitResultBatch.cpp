@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include "Utily/ResultBatch.hpp"
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace std::literals;
+
+TEST(ResultBatch, Outcomes) {
+    Utily::ResultBatch<int> batch;
+    std::vector<int> expected_values;
+    std::vector<size_t> expected_indices;
+    for (int i = 0; i < 200; ++i) {
+        if (i % 37 == 5) {
+            batch.push_error(Utily::Error { Utily::Error::Code::invalid_integer, static_cast<uint64_t>(i) });
+        } else {
+            batch.push_back(Utily::Result<int, Utily::Error> { i * 2 });
+            expected_values.push_back(i * 2);
+            expected_indices.push_back(static_cast<size_t>(i));
+        }
+    }
+
+    EXPECT_EQ(batch.size(), 200);
+    EXPECT_EQ(batch.error_count(), 6);
+    EXPECT_EQ(batch.success_count(), 194);
+    EXPECT_FALSE(batch.all_succeeded());
+    EXPECT_EQ(std::vector(batch.begin(), batch.end()), expected_values);
+
+    std::vector<size_t> indices;
+    batch.for_each_value([&](size_t index, int value) {
+        EXPECT_EQ(value, static_cast<int>(index) * 2);
+        indices.push_back(index);
+    });
+    EXPECT_EQ(indices, expected_indices);
+
+    ASSERT_EQ(batch.errors().size(), 6);
+    EXPECT_EQ(batch.errors()[1].index, 42);
+    EXPECT_EQ(batch.errors()[1].error.values()[0], 42);
+
+    EXPECT_FALSE(batch.has_value(79));
+    EXPECT_EQ(batch.at(79).error()->values()[0], 79);
+    EXPECT_TRUE(batch.has_value(150));
+    EXPECT_EQ(*batch.at(150).value(), 300);
+    EXPECT_EQ(*batch.at(199).value(), 398);
+
+    batch.clear();
+    EXPECT_EQ(batch.size(), 0);
+    EXPECT_TRUE(batch.all_succeeded());
+}
+
+TEST(ResultBatch, MoveOnlyAndCustomError) {
+    Utily::ResultBatch<std::string, std::string_view> batch;
+    batch.push_back(std::string(64, 'a'));
+    batch.push_error("missing"sv);
+    batch.emplace_back(3, 'b');
+    EXPECT_EQ(batch.values()[1], "bbb");
+    EXPECT_EQ(*batch.at(1).error(), "missing"sv);
+    EXPECT_EQ(*batch.at(2).value(), "bbb");
+}
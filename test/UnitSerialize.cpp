@@ -0,0 +1,187 @@
+#include "Utily/Utily.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+    enum class Material : uint16_t {
+        stone,
+        wood,
+    };
+
+    struct Vertex {
+        float x;
+        float y;
+        float z;
+        uint8_t flags;
+    };
+
+    struct Mesh {
+        std::string name;
+        Material material;
+        std::vector<Vertex> vertices;
+        std::vector<uint32_t> indices;
+        std::array<double, 2> range;
+        std::vector<std::string> tags;
+        Utily::StaticVector<int16_t, 4> lods;
+    };
+
+    // Reads a serialised Mesh without copying its arrays.
+    struct MeshView {
+        std::string_view name;
+        Material material;
+        std::span<const Vertex> vertices;
+        std::span<const uint32_t> indices;
+        std::array<double, 2> range;
+        std::vector<std::string_view> tags;
+        Utily::StaticVector<int16_t, 4> lods;
+    };
+
+    struct Arrays {
+        std::span<float> xs;
+        std::span<uint32_t> ys;
+    };
+
+    struct ArraysView {
+        std::span<const float> xs;
+        std::span<const uint32_t> ys;
+    };
+
+    struct Wide {
+        std::vector<int16_t> lods;
+    };
+
+    struct Narrow {
+        Utily::StaticVector<int16_t, 2> lods;
+    };
+
+    // Padded, with a field placed by alignas rather than by its own alignment.
+    struct Aligned {
+        char tag;
+        alignas(8) float weight;
+        bool visible;
+    };
+
+    auto make_mesh() -> Mesh {
+        Mesh mesh { "bunny", Material::wood, {}, {}, { -1.0, 1.0 }, { "animal", "test" }, {} };
+        for (uint32_t i = 0; i < 100; ++i) {
+            mesh.vertices.push_back(Vertex { static_cast<float>(i), 1.0f, 2.0f, static_cast<uint8_t>(i % 3) });
+            mesh.indices.push_back(99 - i);
+        }
+        mesh.lods.push_back(int16_t { 0 });
+        mesh.lods.push_back(int16_t { 2 });
+        return mesh;
+    }
+}
+
+TEST(Serialize, RoundTrip) {
+    using Utily::SerializeDetails::is_flat_v;
+    static_assert(is_flat_v<Vertex> && is_flat_v<std::array<Vertex, 3>>);
+    static_assert(!is_flat_v<Mesh> && !is_flat_v<std::string>);
+    static_assert(Utily::SerializeDetails::schema_hash<Mesh>() == Utily::SerializeDetails::schema_hash<MeshView>());
+    static_assert(Utily::SerializeDetails::schema_hash<Mesh>() != Utily::SerializeDetails::schema_hash<Vertex>());
+
+    const Mesh mesh = make_mesh();
+    std::vector<uint8_t> bytes;
+    Utily::serialize(mesh, bytes);
+
+    auto result = Utily::deserialize<Mesh>(bytes);
+    ASSERT_TRUE(result.has_value()) << result.error().what();
+    const Mesh& copy = result.value();
+    EXPECT_EQ(copy.name, mesh.name);
+    EXPECT_EQ(copy.material, Material::wood);
+    ASSERT_EQ(copy.vertices.size(), 100);
+    EXPECT_EQ(copy.vertices[42].x, 42.0f);
+    EXPECT_EQ(copy.vertices[42].flags, 0);
+    EXPECT_EQ(copy.indices, mesh.indices);
+    EXPECT_EQ(copy.range, mesh.range);
+    EXPECT_EQ(copy.tags, mesh.tags);
+    ASSERT_EQ(copy.lods.size(), 2);
+    EXPECT_EQ(copy.lods.data()[1], 2);
+
+    // Padding is zeroed, so equal values serialise to equal bytes.
+    std::vector<uint8_t> again;
+    Utily::serialize(copy, again);
+    EXPECT_EQ(bytes, again);
+
+    static_assert(is_flat_v<Aligned> && Utily::SerializeDetails::has_padding_v<Aligned>);
+    bytes.clear();
+    Utily::serialize(std::vector<Aligned> { { 'a', 1.5f, true }, { 'b', -2.0f, false } }, bytes);
+    auto aligned = Utily::deserialize<std::vector<Aligned>>(bytes);
+    ASSERT_TRUE(aligned.has_value()) << aligned.error().what();
+    ASSERT_EQ(aligned.value().size(), 2);
+    EXPECT_EQ(aligned.value()[0].tag, 'a');
+    EXPECT_EQ(aligned.value()[0].weight, 1.5f);
+    EXPECT_TRUE(aligned.value()[0].visible);
+    EXPECT_EQ(aligned.value()[1].weight, -2.0f);
+    EXPECT_FALSE(aligned.value()[1].visible);
+}
+
+TEST(Serialize, ZeroCopy) {
+    std::vector<uint8_t> bytes;
+    Utily::serialize(make_mesh(), bytes);
+
+    auto result = Utily::deserialize<MeshView>(bytes);
+    ASSERT_TRUE(result.has_value()) << result.error().what();
+    const MeshView& view = result.value();
+    EXPECT_EQ(view.name, "bunny");
+    ASSERT_EQ(view.vertices.size(), 100);
+    EXPECT_EQ(view.vertices[7].x, 7.0f);
+    EXPECT_EQ(view.indices.back(), 0);
+    EXPECT_EQ(view.tags[1], "test");
+
+    const auto* begin = reinterpret_cast<const uint8_t*>(view.vertices.data());
+    EXPECT_TRUE(begin > bytes.data() && begin < bytes.data() + bytes.size());
+
+    // Arrays from InlineArrays serialise like any other span.
+    auto [owner, xs, ys] = Utily::InlineArrays::alloc_uninit<float, uint32_t>(3, 2);
+    std::ranges::fill(xs, 0.5f);
+    std::ranges::fill(ys, 7u);
+    bytes.clear();
+    Utily::serialize(Arrays { xs, ys }, bytes);
+    auto arrays = Utily::deserialize<ArraysView>(bytes);
+    ASSERT_TRUE(arrays.has_value());
+    EXPECT_EQ(arrays.value().xs.size(), 3);
+    EXPECT_EQ(arrays.value().ys[1], 7u);
+}
+
+TEST(Serialize, Errors) {
+    using Code = Utily::Error::Code;
+
+    std::vector<uint8_t> bytes;
+    Utily::serialize(make_mesh(), bytes);
+
+    auto wrong_type = Utily::deserialize<Vertex>(bytes);
+    ASSERT_TRUE(wrong_type.has_error());
+    EXPECT_EQ(wrong_type.error().code(), Code::serialized_mismatch);
+
+    auto truncated = Utily::deserialize<Mesh>(std::span { bytes }.first(bytes.size() - 1));
+    ASSERT_TRUE(truncated.has_error());
+    EXPECT_EQ(truncated.error().code(), Code::serialized_truncated);
+
+    auto empty = Utily::deserialize<Mesh>({});
+    ASSERT_TRUE(empty.has_error());
+    EXPECT_EQ(empty.error().code(), Code::serialized_truncated);
+
+    // Views need the buffer to keep the alignment it was written with.
+    std::vector<uint8_t> shifted(bytes.size() + 1);
+    std::copy(bytes.begin(), bytes.end(), shifted.begin() + 1);
+    auto misaligned = Utily::deserialize<MeshView>(std::span { shifted }.subspan(1));
+    ASSERT_TRUE(misaligned.has_error());
+    EXPECT_EQ(misaligned.error().code(), Code::serialized_misaligned);
+    auto copied = Utily::deserialize<Mesh>(std::span { shifted }.subspan(1));
+    EXPECT_TRUE(copied.has_value());
+
+    static_assert(Utily::SerializeDetails::schema_hash<Wide>() == Utily::SerializeDetails::schema_hash<Narrow>());
+    bytes.clear();
+    Utily::serialize(Wide { { 1, 2, 3 } }, bytes);
+    auto too_large = Utily::deserialize<Narrow>(bytes);
+    ASSERT_TRUE(too_large.has_error());
+    EXPECT_EQ(too_large.error().code(), Code::serialized_too_large);
+}
@@ -1,12 +1,17 @@
 #include <gtest/gtest.h>
 
 #include "Utily/Utily.hpp"
+#include "Utily/Simd.hpp"
 #include "Utily/Simd128.hpp"
 #include "Utily/Simd512.hpp"
+#include "Utily/Validate.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
+#include <limits>
 #include <memory>
+#include <numeric>
 #include <random>
 #include <ranges>
 #include <string_view>
@@ -74,6 +79,36 @@ TEST(Simd, find_first_of) {
         STRING.begin() + Utily::Simd128::Char::find_first_of(STRING.data(), STRING.size(), delims.data(), delims.size()));
 }
 
+TEST(Simd, find_first_of_charset) {
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<> dist(std::numeric_limits<char>::min(), std::numeric_limits<char>::max());
+
+    std::string src;
+    std::string delims;
+    for (size_t i = 0; i < 300; ++i) {
+        src.resize(i);
+        std::ranges::generate(src, [&]() { return static_cast<char>(dist(gen)); });
+        delims.resize(i % 40);
+        std::ranges::generate(delims, [&]() { return static_cast<char>(dist(gen)); });
+
+        const auto expected = std::distance(src.begin(), std::ranges::find_first_of(src, delims));
+        EXPECT_EQ(expected, Utily::Simd128::Char::find_first_of(src.data(), src.size(), delims.data(), delims.size()));
+        EXPECT_EQ(expected, Utily::Simd128::Char::find_first_of(src.data(), src.size(), Utily::Simd128::Char::CharSet { delims }));
+        EXPECT_EQ(expected, Utily::Simd512::Char::find_first_of(src.data(), src.size(), Utily::Simd512::Char::CharSet { delims }));
+    }
+
+    // every byte value is representable.
+    std::string all_bytes;
+    for (int c = std::numeric_limits<char>::min(); c <= std::numeric_limits<char>::max(); ++c) {
+        all_bytes.push_back(static_cast<char>(c));
+    }
+    const auto set = Utily::Simd128::Char::CharSet { std::string_view { all_bytes }.substr(128) };
+    for (char c : all_bytes) {
+        EXPECT_EQ(set.contains(c), std::string_view { all_bytes }.substr(128).find(c) != std::string_view::npos);
+    }
+}
+
 TEST(Simd128, search_4letters) {
     std::string_view word1 = "sent";
     std::string_view word2 = "worl";
@@ -287,3 +322,351 @@ TEST(Simd, search_8letters_find_random) {
         }
     }
 }
+
+TEST(Simd, search_any_length) {
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    // a small alphabet so partial matches are common.
+    std::uniform_int_distribution<> dist('a', 'c');
+
+    std::string src;
+    std::string needle;
+    for (size_t i = 0; i < 300; ++i) {
+        src.resize(i);
+        std::ranges::generate(src, [&]() { return static_cast<char>(dist(gen)); });
+
+        for (size_t len = 2; len < 70; ++len) {
+            // existing substrings and random needles.
+            if (len <= src.size()) {
+                needle = src.substr(src.size() - len);
+            } else {
+                needle.resize(len);
+                std::ranges::generate(needle, [&]() { return static_cast<char>(dist(gen)); });
+            }
+            const auto expected = std::distance(src.begin(), std::search(src.begin(), src.end(), needle.begin(), needle.end()));
+            EXPECT_EQ(expected, Utily::Simd128::Char::search(src.data(), src.size(), needle.data(), needle.size()));
+            EXPECT_EQ(expected, Utily::Simd128::Char::search_first_last(src.data(), src.size(), needle.data(), needle.size()));
+            EXPECT_EQ(expected, Utily::Simd512::Char::search(src.data(), src.size(), needle.data(), needle.size()));
+        }
+    }
+
+    EXPECT_EQ(Utily::Simd128::Char::search<3>(STRING.data(), STRING.size(), "sen"), static_cast<std::ptrdiff_t>(STRING.find("sen")));
+    EXPECT_EQ(Utily::Simd512::Char::search<3>(STRING.data(), STRING.size(), "sen"), static_cast<std::ptrdiff_t>(STRING.find("sen")));
+}
+
+TEST(Simd, reverse_kernels) {
+    std::mt19937 gen(11);
+    std::uniform_int_distribution<> dist('a', 'd');
+    const auto set = "cd\xff"sv;
+    const auto set128 = Utily::Simd128::Char::CharSet { set };
+    const auto set512 = Utily::Simd512::Char::CharSet { set };
+
+    std::string src;
+    std::string needle;
+    for (size_t i = 0; i < 300; ++i) {
+        src.resize(i);
+        std::ranges::generate(src, [&]() { return static_cast<char>(dist(gen)); });
+
+        const auto view = std::string_view { src };
+        const auto npos_to_index = [](size_t pos) {
+            return pos == std::string_view::npos ? std::ptrdiff_t { -1 } : static_cast<std::ptrdiff_t>(pos);
+        };
+
+        const auto expected_rfind = npos_to_index(view.rfind('a'));
+        EXPECT_EQ(expected_rfind, Utily::Simd128::Char::rfind(src.data(), src.size(), 'a'));
+        EXPECT_EQ(expected_rfind, Utily::Simd512::Char::rfind(src.data(), src.size(), 'a'));
+        EXPECT_EQ(-1, Utily::Simd128::Char::rfind(src.data(), src.size(), 'z'));
+        EXPECT_EQ(-1, Utily::Simd512::Char::rfind(src.data(), src.size(), 'z'));
+
+        const auto expected_last_of = npos_to_index(view.find_last_of(set));
+        EXPECT_EQ(expected_last_of, Utily::Simd128::Char::find_last_of(src.data(), src.size(), set128));
+        EXPECT_EQ(expected_last_of, Utily::Simd512::Char::find_last_of(src.data(), src.size(), set512));
+        EXPECT_EQ(expected_last_of, Utily::Simd128::Char::find_last_of(src.data(), src.size(), set.data(), set.size()));
+
+        for (size_t len = 0; len < 70; ++len) {
+            // prefixes exist only at the very start, random needles mostly don't exist.
+            if (len <= src.size() && len % 2 == 0) {
+                needle = src.substr(0, len);
+            } else {
+                needle.resize(len);
+                std::ranges::generate(needle, [&]() { return static_cast<char>(dist(gen)); });
+            }
+            const auto expected = npos_to_index(view.rfind(needle));
+            EXPECT_EQ(expected, Utily::Simd128::Char::rsearch(src.data(), src.size(), needle.data(), needle.size()));
+            EXPECT_EQ(expected, Utily::Simd512::Char::rsearch(src.data(), src.size(), needle.data(), needle.size()));
+        }
+    }
+}
+
+TEST(Simd, icase_and_classes) {
+    std::mt19937 gen(5);
+    // mixed case letters, the bytes either side of 'A'-'Z' / 'a'-'z', whitespace, digits and non-ascii.
+    constexpr auto alphabet = "aAbB@[`{ \t\n\v\f\r\b09/:\x80\xff"sv;
+    std::uniform_int_distribution<size_t> pick(0, alphabet.size() - 1);
+
+    const auto lower = [](std::string s) {
+        std::ranges::transform(s, s.begin(), [](char c) { return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + 32) : c; });
+        return s;
+    };
+    const auto is_space = [](char c) { return c == ' ' || (c >= '\t' && c <= '\r'); };
+    const auto is_digit = [](char c) { return c >= '0' && c <= '9'; };
+    const auto is_non_ascii = [](char c) { return static_cast<unsigned char>(c) >= 0x80; };
+
+    std::string src;
+    for (size_t i = 0; i < 200; ++i) {
+        src.resize(i);
+        std::ranges::generate(src, [&]() { return alphabet[pick(gen)]; });
+        const auto src_lower = lower(src);
+        const auto index_of = [&](auto iter) { return std::distance(src.begin(), iter); };
+
+        for (const char val : alphabet) {
+            const auto expected = static_cast<std::ptrdiff_t>(std::min(src_lower.find(lower(std::string(1, val))), src.size()));
+            EXPECT_EQ(expected, Utily::Simd128::Char::find_icase(src.data(), src.size(), val));
+            EXPECT_EQ(expected, Utily::Simd512::Char::find_icase(src.data(), src.size(), val));
+        }
+        for (size_t len = 0; len < 6 && len <= src.size(); ++len) {
+            // Flip the case of a substring from the back, it must still be found.
+            auto needle = src.substr(src.size() - len);
+            std::ranges::transform(needle, needle.begin(), [](char c) { return Utily::Simd128::Char::Details::is_ascii_alpha(c) ? static_cast<char>(c ^ 0x20) : c; });
+            const auto expected = static_cast<std::ptrdiff_t>(std::min(src_lower.find(lower(needle)), src.size()));
+            EXPECT_EQ(expected, Utily::Simd128::Char::search_icase(src.data(), src.size(), needle.data(), needle.size()));
+            EXPECT_EQ(expected, Utily::Simd512::Char::search_icase(src.data(), src.size(), needle.data(), needle.size()));
+        }
+
+        EXPECT_EQ(index_of(std::ranges::find_if_not(src, is_space)), Utily::Simd128::Char::find_first_non_whitespace(src.data(), src.size()));
+        EXPECT_EQ(index_of(std::ranges::find_if_not(src, is_space)), Utily::Simd512::Char::find_first_non_whitespace(src.data(), src.size()));
+        EXPECT_EQ(index_of(std::ranges::find_if(src, is_digit)), Utily::Simd128::Char::find_first_digit(src.data(), src.size()));
+        EXPECT_EQ(index_of(std::ranges::find_if(src, is_digit)), Utily::Simd512::Char::find_first_digit(src.data(), src.size()));
+        EXPECT_EQ(index_of(std::ranges::find_if(src, is_non_ascii)), Utily::Simd128::Char::find_first_non_ascii(src.data(), src.size()));
+        EXPECT_EQ(index_of(std::ranges::find_if(src, is_non_ascii)), Utily::Simd512::Char::find_first_non_ascii(src.data(), src.size()));
+    }
+
+    const auto header = "Host: example.com\r\nCONTENT-LENGTH: 42\r\n"sv;
+    EXPECT_EQ(Utily::Simd128::Char::search_icase(header.data(), header.size(), "content-length", 14), 19);
+    EXPECT_EQ(Utily::Simd512::Char::search_icase(header.data(), header.size(), "Content-Length", 14), 19);
+}
+
+TEST(Simd, utf8_validation) {
+    const auto find_invalid = [](std::string_view s) {
+        const auto offset = Utily::Simd128::Char::find_first_invalid_utf8(s.data(), s.size());
+        EXPECT_EQ(offset, Utily::Simd512::Char::find_first_invalid_utf8(s.data(), s.size()));
+        return offset;
+    };
+    EXPECT_EQ(find_invalid(""), 0);
+    EXPECT_EQ(find_invalid("plain ascii"), 11);
+    EXPECT_EQ(find_invalid("caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80 \xED\x9F\xBF \xF4\x8F\xBF\xBF"), 23);
+
+    EXPECT_EQ(find_invalid("ab\x80"), 2);              // stray continuation.
+    EXPECT_EQ(find_invalid("ab\xC3"), 2);              // truncated.
+    EXPECT_EQ(find_invalid("ab\xC0\xAF"), 2);          // overlong 2 byte.
+    EXPECT_EQ(find_invalid("ab\xE0\x80\xAF"), 2);      // overlong 3 byte.
+    EXPECT_EQ(find_invalid("ab\xF0\x80\x80\xAF"), 2);  // overlong 4 byte.
+    EXPECT_EQ(find_invalid("ab\xED\xA0\x80"), 2);      // surrogate.
+    EXPECT_EQ(find_invalid("ab\xF4\x90\x80\x80"), 2);  // past U+10FFFF.
+    EXPECT_EQ(find_invalid("ab\xF8"), 2);
+    EXPECT_EQ(find_invalid("ab\xE2\x82z"), 2);
+
+    // Every offset, so errors land on and across each block boundary.
+    const std::string valid = [] {
+        std::string s;
+        while (s.size() < 300) {
+            s += "text \xE2\x82\xAC\xF0\x9F\x98\x80";
+        }
+        return s;
+    }();
+    EXPECT_EQ(static_cast<size_t>(find_invalid(valid)), valid.size());
+    for (size_t i = 0; i < valid.size(); ++i) {
+        if ((static_cast<uint8_t>(valid[i]) & 0xC0) == 0x80) {
+            continue;
+        }
+        std::string tmp = valid;
+        tmp[i] = '\xFF';
+        EXPECT_EQ(static_cast<size_t>(find_invalid(tmp)), i);
+        tmp = valid.substr(0, i) + "\xE2\x82";
+        EXPECT_EQ(static_cast<size_t>(find_invalid(tmp)), i);
+    }
+
+    EXPECT_TRUE(Utily::Simd128::Char::validate_utf8(valid).has_value());
+    EXPECT_TRUE(Utily::Simd512::Char::is_ascii(STRING).has_value());
+    EXPECT_TRUE(Utily::is_ascii(STRING).has_value());
+    const auto result = Utily::Simd128::Char::is_ascii(valid);
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(result.error().what(), "Non-ASCII byte at offset 5"sv);
+    EXPECT_EQ(Utily::Simd512::Char::validate_utf8("ab\xC0\xAF"sv).error().what(), "Invalid UTF-8 at offset 2"sv);
+    EXPECT_EQ(Utily::validate_utf8("ab\xC0\xAF"sv).error().what(), "Invalid UTF-8 at offset 2"sv);
+}
+
+template <typename T>
+class SimdLanes : public testing::Test { };
+using SimdLaneTypes = testing::Types<uint16_t, int32_t, uint64_t, float, double>;
+TYPED_TEST_SUITE(SimdLanes, SimdLaneTypes);
+
+template <typename T>
+struct LaneKernels;
+#define UTY_LANE_KERNELS(T, NS)                                                                                  \
+    template <>                                                                                                  \
+    struct LaneKernels<T> {                                                                                      \
+        static auto find(const T* s, size_t n, T v) { return Utily::Simd128::NS::find(s, n, v); }                 \
+        static auto count(const T* s, size_t n, T v) { return Utily::Simd128::NS::count(s, n, v); }               \
+        static auto find_if_greater(const T* s, size_t n, T v) { return Utily::Simd128::NS::find_if_greater(s, n, v); } \
+        static auto min(const T* s, size_t n) { return Utily::Simd128::NS::min(s, n); }                           \
+        static auto max(const T* s, size_t n) { return Utily::Simd128::NS::max(s, n); }                           \
+    };
+UTY_LANE_KERNELS(uint16_t, U16)
+UTY_LANE_KERNELS(int32_t, I32)
+UTY_LANE_KERNELS(uint64_t, U64)
+UTY_LANE_KERNELS(float, F32)
+UTY_LANE_KERNELS(double, F64)
+#undef UTY_LANE_KERNELS
+
+TYPED_TEST(SimdLanes, matches_std) {
+    using T = TypeParam;
+    using K = LaneKernels<T>;
+
+    std::mt19937_64 gen(3);
+    // Values at both ends of the type, so unsigned and sign bit handling is exercised.
+    const auto values = std::to_array<T>({
+        std::numeric_limits<T>::lowest(),
+        static_cast<T>(std::numeric_limits<T>::lowest() + T { 1 }),
+        T { 0 },
+        T { 1 },
+        T { 7 },
+        static_cast<T>(std::numeric_limits<T>::max() - T { 1 }),
+        std::numeric_limits<T>::max(),
+    });
+    std::uniform_int_distribution<size_t> pick(0, values.size() - 1);
+
+    std::vector<T> src;
+    for (size_t i = 0; i < 70; ++i) {
+        src.resize(i);
+        std::ranges::generate(src, [&]() { return values[pick(gen)]; });
+
+        for (const T v : values) {
+            EXPECT_EQ(std::distance(src.begin(), std::ranges::find(src, v)), K::find(src.data(), src.size(), v));
+            EXPECT_EQ(static_cast<size_t>(std::ranges::count(src, v)), K::count(src.data(), src.size(), v));
+            EXPECT_EQ(std::distance(src.begin(), std::ranges::find_if(src, [&](T x) { return x > v; })), K::find_if_greater(src.data(), src.size(), v));
+            EXPECT_EQ(std::distance(src.begin(), Utily::Simd::find(src.begin(), src.end(), v)), K::find(src.data(), src.size(), v));
+        }
+        if (!src.empty()) {
+            EXPECT_EQ(std::ranges::min(src), K::min(src.data(), src.size()));
+            EXPECT_EQ(std::ranges::max(src), K::max(src.data(), src.size()));
+        }
+    }
+    if constexpr (std::floating_point<T>) {
+        const auto with_nan = std::to_array<T>({ T { 3 }, std::numeric_limits<T>::quiet_NaN(), T { -2 }, T { 5 }, T { 1 } });
+        EXPECT_EQ(K::min(with_nan.data(), with_nan.size()), T { -2 });
+        EXPECT_EQ(K::max(with_nan.data(), with_nan.size()), T { 5 });
+        EXPECT_EQ(K::find(with_nan.data(), with_nan.size(), std::numeric_limits<T>::quiet_NaN()), 5);
+        EXPECT_EQ(K::min(with_nan.data(), 0), std::numeric_limits<T>::infinity());
+    }
+}
+
+TEST(Simd, generic_find) {
+    const auto bytes = std::vector<uint8_t> { 1, 2, 3, 200 };
+    EXPECT_EQ(Utily::Simd::find(bytes.begin(), bytes.end(), uint8_t { 200 }), bytes.end() - 1);
+    const auto shorts = std::vector<int16_t> { 1, -2, 3 };
+    EXPECT_EQ(Utily::Simd::find(shorts.begin(), shorts.end(), int16_t { -2 }), shorts.begin() + 1);
+    const auto longs = std::vector<int64_t> { 1, -2, 3 };
+    EXPECT_EQ(Utily::Simd::find(longs.begin(), longs.end(), int64_t { 3 }), longs.begin() + 2);
+    // A value of a different type than the elements keeps std::find's comparison semantics.
+    const auto ints = std::vector<int32_t> { 1, 2, 3 };
+    EXPECT_EQ(Utily::Simd::find(ints.begin(), ints.end(), int64_t { 1 } << 32), ints.end());
+    EXPECT_EQ(Utily::Simd::find(ints.begin(), ints.end(), 2.0), ints.begin() + 1);
+    EXPECT_EQ(Utily::Simd::find_first_of(STRING.begin(), STRING.end(), "!z"sv.begin(), "!z"sv.end()), STRING.begin() + static_cast<std::ptrdiff_t>(STRING.find_first_of("!z")));
+}
+
+template <typename T>
+class SimdReductions : public testing::Test { };
+using SimdReductionTypes = testing::Types<int32_t, float, double>;
+TYPED_TEST_SUITE(SimdReductions, SimdReductionTypes);
+
+template <typename T>
+struct ReductionKernels;
+#define UTY_REDUCTION_KERNELS(T, NS)                                                                  \
+    template <>                                                                                       \
+    struct ReductionKernels<T> {                                                                      \
+        static auto minmax_128(const T* s, size_t n) { return Utily::Simd128::NS::minmax(s, n); }      \
+        static auto minmax_512(const T* s, size_t n) { return Utily::Simd512::NS::minmax(s, n); }      \
+        static auto argmin_128(const T* s, size_t n) { return Utily::Simd128::NS::argmin(s, n); }      \
+        static auto argmin_512(const T* s, size_t n) { return Utily::Simd512::NS::argmin(s, n); }      \
+        static auto argmax_128(const T* s, size_t n) { return Utily::Simd128::NS::argmax(s, n); }      \
+        static auto argmax_512(const T* s, size_t n) { return Utily::Simd512::NS::argmax(s, n); }      \
+        static auto sum_128(const T* s, size_t n) { return Utily::Simd128::NS::sum(s, n); }            \
+        static auto sum_512(const T* s, size_t n) { return Utily::Simd512::NS::sum(s, n); }            \
+        static auto min_512(const T* s, size_t n) { return Utily::Simd512::NS::min(s, n); }            \
+        static auto max_512(const T* s, size_t n) { return Utily::Simd512::NS::max(s, n); }            \
+    };
+UTY_REDUCTION_KERNELS(int32_t, I32)
+UTY_REDUCTION_KERNELS(float, F32)
+UTY_REDUCTION_KERNELS(double, F64)
+#undef UTY_REDUCTION_KERNELS
+
+TYPED_TEST(SimdReductions, matches_std) {
+    using T = TypeParam;
+    using K = ReductionKernels<T>;
+
+    std::mt19937_64 gen(5);
+    // A small value range so ties are common and argmin/argmax must pick the first.
+    std::uniform_int_distribution<int> pick(-20, 20);
+
+    std::vector<T> src;
+    for (size_t i = 0; i < 150; ++i) {
+        src.resize(i);
+        std::ranges::generate(src, [&]() { return static_cast<T>(pick(gen)); });
+
+        const auto expected_min = std::distance(src.begin(), std::ranges::min_element(src));
+        const auto expected_max = std::distance(src.begin(), std::ranges::max_element(src));
+        EXPECT_EQ(expected_min, K::argmin_128(src.data(), src.size()));
+        EXPECT_EQ(expected_min, K::argmin_512(src.data(), src.size()));
+        EXPECT_EQ(expected_max, K::argmax_128(src.data(), src.size()));
+        EXPECT_EQ(expected_max, K::argmax_512(src.data(), src.size()));
+
+        // Small integers sum exactly in every order.
+        const auto expected_sum = std::accumulate(src.begin(), src.end(), decltype(K::sum_128(nullptr, 0)) { 0 });
+        EXPECT_EQ(expected_sum, K::sum_128(src.data(), src.size()));
+        EXPECT_EQ(expected_sum, K::sum_512(src.data(), src.size()));
+
+        if (!src.empty()) {
+            const auto [lo, hi] = std::ranges::minmax(src);
+            const auto result_128 = K::minmax_128(src.data(), src.size());
+            const auto result_512 = K::minmax_512(src.data(), src.size());
+            EXPECT_EQ(lo, result_128.min);
+            EXPECT_EQ(hi, result_128.max);
+            EXPECT_EQ(lo, result_512.min);
+            EXPECT_EQ(hi, result_512.max);
+            EXPECT_EQ(lo, K::min_512(src.data(), src.size()));
+            EXPECT_EQ(hi, K::max_512(src.data(), src.size()));
+        }
+    }
+
+    if constexpr (std::floating_point<T>) {
+        constexpr T nan = std::numeric_limits<T>::quiet_NaN();
+        const auto with_nan = std::to_array<T>({ nan, T { 3 }, nan, T { -2 }, T { 5 }, T { -2 }, T { 1 } });
+        EXPECT_EQ(K::argmin_128(with_nan.data(), with_nan.size()), 3);
+        EXPECT_EQ(K::argmin_512(with_nan.data(), with_nan.size()), 3);
+        EXPECT_EQ(K::argmax_128(with_nan.data(), with_nan.size()), 4);
+        EXPECT_EQ(K::argmax_512(with_nan.data(), with_nan.size()), 4);
+        const auto all_nan = std::to_array<T>({ nan, nan });
+        EXPECT_EQ(K::argmin_128(all_nan.data(), all_nan.size()), 2);
+        EXPECT_EQ(K::argmax_512(all_nan.data(), all_nan.size()), 2);
+    } else {
+        const auto extremes = std::to_array<int32_t>({ 0, std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::max(), 0 });
+        EXPECT_EQ(Utily::Simd128::I32::sum(extremes.data(), extremes.size()), int64_t { std::numeric_limits<int32_t>::max() } * 2);
+        EXPECT_EQ(Utily::Simd512::I32::sum(extremes.data(), extremes.size()), int64_t { std::numeric_limits<int32_t>::max() } * 2);
+    }
+}
+
+TEST(Simd, compensated_sum) {
+    // One large value followed by many values too small to register in a naive float sum.
+    std::vector<float> src(100'000, 1e-4f);
+    src.front() = 1e4f;
+    const double exact = std::accumulate(src.begin(), src.end(), 0.0);
+
+    using Utily::Simd128::Summation;
+    const auto error = [&](float x) { return std::abs(static_cast<double>(x) - exact); };
+    EXPECT_LT(error(Utily::Simd128::F32::sum(src.data(), src.size(), Summation::kahan)), 1e-2);
+    EXPECT_LT(error(Utily::Simd512::F32::sum(src.data(), src.size(), Summation::kahan)), 1e-2);
+    EXPECT_LT(error(Utily::Simd128::F32::sum(src.data(), src.size(), Summation::pairwise)), 1.0);
+    EXPECT_LT(error(Utily::Simd512::F32::sum(src.data(), src.size(), Summation::pairwise)), 1.0);
+    EXPECT_GT(error(std::accumulate(src.begin(), src.end(), 0.0f)), 1.0);
+}
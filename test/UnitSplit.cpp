@@ -1,10 +1,18 @@
 #include <gtest/gtest.h>
 
 #include "Utily/Split.hpp"
+#include "Utily/Error.hpp"
+#include "Utily/Pipeline.hpp"
+#include "Utily/StaticVector.hpp"
+#include "Utily/TypeErasedVector.hpp"
 
+#include <charconv>
 #include <list>
 #include <memory>
+#include <string>
 #include <string_view>
+#include <tuple>
+#include <vector>
 
 using namespace std::literals;
 
@@ -124,4 +132,94 @@ TEST(Split, split) {
         EXPECT_EQ(splitter.evaluate().size(), 1);
     }
 
-}
\ No newline at end of file
+}
+
+TEST(Split, rsplit) {
+    { // Last token first
+        auto string = " usr/local//lib/libutily.a"sv;
+        auto splitter = Utily::rsplit(string, '/');
+        static_assert(std::same_as<decltype(splitter), Utily::Split::ByElementReverse<std::string_view>>);
+        EXPECT_EQ(*splitter.begin(), "libutily.a"sv);
+        EXPECT_EQ(splitter.evaluate(), (std::vector { "libutily.a"sv, "lib"sv, "local"sv, " usr"sv }));
+    }
+    { // Leading, trailing and only delimiters
+        const auto padded = "//a//b//"sv;
+        const auto only_delims = "////"sv;
+        const auto empty = ""sv;
+        EXPECT_EQ(Utily::rsplit(padded, '/').evaluate(), (std::vector { "b"sv, "a"sv }));
+        EXPECT_TRUE(Utily::rsplit(only_delims, '/').evaluate().empty());
+        EXPECT_TRUE(Utily::rsplit(empty, '/').evaluate().empty());
+    }
+    { // Longer than a vector, mirrors the forward split
+        std::string string;
+        for (int i = 0; i < 100; ++i) {
+            string += std::to_string(i) + (i % 3 == 0 ? "  " : " ");
+        }
+        auto forward = Utily::split(string, ' ').evaluate();
+        std::ranges::reverse(forward);
+        EXPECT_EQ(Utily::rsplit(string, ' ').evaluate(), forward);
+    }
+    { // Non contiguous
+        const auto list = std::list { 1, 0, 2, 3, 0, 0 };
+        std::vector<std::vector<int>> tokens;
+        for (auto token : Utily::rsplit(list, 0)) {
+            tokens.emplace_back(token.begin(), token.end());
+        }
+        EXPECT_EQ(tokens, (std::vector<std::vector<int>> { { 2, 3 }, { 1 } }));
+    }
+}
+
+TEST(Split, Pipeline) {
+    const auto text = "1 2\n\n3 4\n5 6\n"sv;
+    const auto to_int = [](std::string_view token) {
+        int value = 0;
+        std::from_chars(token.data(), token.data() + token.size(), value);
+        return value;
+    };
+    const auto to_pair = [&](std::string_view line) {
+        auto iter = Utily::split(line, ' ').begin();
+        const auto first = to_int(*iter);
+        return std::tuple { first, to_int(*++iter) };
+    };
+    { // Into a vector, stages chain left to right
+        std::vector<int> values;
+        const auto count = Utily::split(text, ' ') | Utily::transform([](std::string_view token) { return token.front(); })
+            | Utily::transform([](char c) { return c - '0'; }) | Utily::collect_into(values);
+        EXPECT_EQ(count, 4);
+        EXPECT_EQ(values, (std::vector { 1, 2, 4, 6 }));
+    }
+    { // A tuple per line fills one sink per element
+        std::vector<int> xs;
+        Utily::StaticVector<int, 8> ys;
+        EXPECT_EQ(Utily::split(text, '\n') | Utily::transform(to_pair) | Utily::collect_into(xs, ys), 3);
+        EXPECT_EQ(xs, (std::vector { 1, 3, 5 }));
+        EXPECT_EQ(std::vector(ys.begin(), ys.end()), (std::vector { 2, 4, 6 }));
+    }
+    { // TypeErasedVector sink, and the view can be iterated directly
+        Utily::TypeErasedVector values { int {} };
+        const auto view = Utily::split(text, '\n') | Utily::transform(to_pair);
+        EXPECT_EQ(view | Utily::transform([](auto pair) { return std::get<0>(pair) * std::get<1>(pair); }) | Utily::collect_into(values), 3);
+        EXPECT_EQ(std::vector(values.as_span<int>().begin(), values.as_span<int>().end()), (std::vector { 2, 12, 30 }));
+        int sum = 0;
+        for (const auto [x, y] : view) {
+            sum += x + y;
+        }
+        EXPECT_EQ(sum, 21);
+    }
+    { // Stops at the first error
+        const auto parse = [&](std::string_view token) -> Utily::Result<int, Utily::Error> {
+            if (token == "x") {
+                return Utily::Error { "bad token" };
+            }
+            return to_int(token);
+        };
+        const auto bad = "1,2,x,3"sv;
+        const auto good = "1,2"sv;
+        std::vector<int> values;
+        const auto result = Utily::split(bad, ',') | Utily::transform(parse) | Utily::collect_into(values);
+        ASSERT_TRUE(result.has_error());
+        EXPECT_EQ(result.error().what(), "bad token"sv);
+        EXPECT_EQ(values, (std::vector { 1, 2 }));
+        EXPECT_EQ((Utily::split(good, ',') | Utily::transform(parse) | Utily::collect_into(values)).value(), 2);
+    }
+}
@@ -2,7 +2,14 @@
 
 #include "Utily/StaticVector.hpp"
 
+#include <array>
+#include <cstring>
 #include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 TEST(StaticVector, Constructors) {
     { // default
@@ -205,4 +212,97 @@ TEST(StaticVector, ProperDestruction) {
         EXPECT_EQ(copy_constructions, 0);
         EXPECT_EQ(destructions, 14);
     }
-}
\ No newline at end of file
+}
+TEST(StaticVector, CopyAndMove) {
+    static_assert(std::is_trivially_copyable_v<Utily::StaticVector<int, 10>>);
+    static_assert(!std::is_trivially_copyable_v<Utily::StaticVector<std::string, 10>>);
+
+    { // trivially copyable
+        Utily::StaticVector<int, 10> a { 1, 2, 3 };
+        Utily::StaticVector<int, 10> b = a;
+        EXPECT_EQ(b.size(), 3);
+        EXPECT_TRUE(std::ranges::equal(a, b));
+    }
+
+    { // copy
+        Utily::StaticVector<std::string, 10> a {};
+        a.push_back(std::string { "a" });
+        a.push_back(std::string { "b" });
+        Utily::StaticVector<std::string, 10> b = a;
+        EXPECT_EQ(b.size(), 2);
+        EXPECT_TRUE(std::ranges::equal(a, b));
+        b = a;
+        EXPECT_TRUE(std::ranges::equal(a, b));
+    }
+
+    { // move
+        Utily::StaticVector<std::unique_ptr<int>, 10> a {};
+        a.push_back(std::make_unique<int>(1));
+        a.push_back(std::make_unique<int>(2));
+        Utily::StaticVector<std::unique_ptr<int>, 10> b = std::move(a);
+        EXPECT_EQ(b.size(), 2);
+        EXPECT_EQ(*b[0], 1);
+        EXPECT_EQ(*b[1], 2);
+    }
+}
+
+TEST(StaticVector, BulkOperations) {
+    const auto first = std::to_array({ 1, 2, 3, 4 });
+    const auto second = std::to_array({ 8, 9 });
+
+    auto check = [&]<typename T>(T) {
+        auto to_t = [](int i) {
+            if constexpr (std::same_as<T, std::string>) {
+                return std::to_string(i);
+            } else {
+                return i;
+            }
+        };
+        std::vector<T> a, b;
+        std::ranges::transform(first, std::back_inserter(a), to_t);
+        std::ranges::transform(second, std::back_inserter(b), to_t);
+
+        Utily::StaticVector<T, 10> sv {};
+        sv.assign(a);
+        EXPECT_TRUE(std::ranges::equal(sv, a));
+
+        sv.append(b);
+        EXPECT_EQ(sv.size(), 6);
+        EXPECT_TRUE(std::ranges::equal(sv, std::vector<T> { a[0], a[1], a[2], a[3], b[0], b[1] }));
+
+        auto iter = sv.insert(std::as_const(sv).begin() + 1, b);
+        EXPECT_EQ(*iter, b[0]);
+        EXPECT_TRUE(std::ranges::equal(sv, std::vector<T> { a[0], b[0], b[1], a[1], a[2], a[3], b[0], b[1] }));
+
+        iter = sv.erase(std::as_const(sv).begin() + 1, std::as_const(sv).begin() + 3);
+        EXPECT_EQ(*iter, a[1]);
+        EXPECT_TRUE(std::ranges::equal(sv, std::vector<T> { a[0], a[1], a[2], a[3], b[0], b[1] }));
+
+        sv.erase(std::as_const(sv).begin());
+        sv.insert(std::as_const(sv).end(), a[0]);
+        EXPECT_TRUE(std::ranges::equal(sv, std::vector<T> { a[1], a[2], a[3], b[0], b[1], a[0] }));
+    };
+    check(int {});
+    check(std::string {});
+}
+
+TEST(StaticVector, Layout) {
+    static_assert(sizeof(Utily::StaticVector<uint8_t, 15>) == 16);
+    static_assert(sizeof(Utily::StaticVector<uint16_t, 300>) == 602);
+
+    using SmallString = Utily::StaticVector<char, 15, Utily::StaticVectorLayout { .size_before_data = true, .alignment = 16 }>;
+    static_assert(sizeof(SmallString) == 16 && alignof(SmallString) == 16);
+
+    SmallString str {};
+    str.assign(std::span { "hello", 5 });
+    EXPECT_EQ(std::string_view(str.data(), str.size()), "hello");
+
+    // the size is the first byte, followed by the characters.
+    std::array<char, 16> bytes;
+    std::memcpy(bytes.data(), &str, sizeof(str));
+    EXPECT_EQ(bytes[0], 5);
+    EXPECT_EQ(std::string_view(bytes.data() + 1, 5), "hello");
+
+    SmallString copy = str;
+    EXPECT_TRUE(std::ranges::equal(copy, str));
+}
@@ -0,0 +1,94 @@
+#include "Utily/Utily.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+TEST(TupleAlgo, ForEachAndCopy) {
+    auto tuple = std::make_tuple(1, 2.5, std::string { "three" });
+    std::string seen;
+    Utily::TupleAlgo::for_each(tuple, [&](auto& element) {
+        if constexpr (std::same_as<std::remove_cvref_t<decltype(element)>, std::string>) {
+            seen += element;
+        } else {
+            seen += std::to_string(static_cast<int>(element));
+        }
+    });
+    EXPECT_EQ(seen, "12three");
+
+    int calls = 0;
+    Utily::TupleAlgo::for_each(std::make_tuple(1, 2u, 3l), [&](auto) { ++calls; });
+    EXPECT_EQ(calls, 3);
+
+    std::array<int, 3> out {};
+    Utily::TupleAlgo::copy(std::make_tuple(4, 5, 6), out.begin());
+    EXPECT_EQ(out, (std::array { 4, 5, 6 }));
+
+    std::string moved_from = "moved";
+    std::array<std::string, 1> strings;
+    Utily::TupleAlgo::copy(std::forward_as_tuple(std::move(moved_from)), strings.begin());
+    EXPECT_EQ(strings[0], "moved");
+}
+
+TEST(TupleAlgo, Queries) {
+    constexpr auto tuple = std::make_tuple(1, 2.0f, 3u, -4);
+
+    static_assert(Utily::TupleAlgo::find_if(tuple, [](auto v) { return v > 2; }) == 2);
+    static_assert(Utily::TupleAlgo::find_if(tuple, [](auto v) { return v > 10; }) == 4);
+    static_assert(Utily::TupleAlgo::any_of(tuple, [](auto v) { return v < 0; }));
+    static_assert(!Utily::TupleAlgo::all_of(tuple, [](auto v) { return v > 0; }));
+    static_assert(Utily::TupleAlgo::all_of(std::tuple<> {}, [](auto) { return false; }));
+
+    constexpr auto doubled = Utily::TupleAlgo::transform(tuple, [](auto v) { return v * 2; });
+    static_assert(std::same_as<std::remove_const_t<decltype(doubled)>, std::tuple<int, float, unsigned, int>>);
+    static_assert(std::get<1>(doubled) == 4.0f && std::get<3>(doubled) == -8);
+
+    // Stops at the first match.
+    int evaluated = 0;
+    EXPECT_EQ(Utily::TupleAlgo::find_if(tuple, [&](auto v) { ++evaluated; return v == 2; }), 1);
+    EXPECT_EQ(evaluated, 2);
+
+    size_t index_sum = 0;
+    Utily::TupleAlgo::apply_indexed(tuple, [&]<size_t I>(std::integral_constant<size_t, I>, const auto& v) {
+        static_assert(std::same_as<std::remove_cvref_t<decltype(v)>, std::tuple_element_t<I, std::remove_const_t<decltype(tuple)>>>);
+        index_sum += I;
+    });
+    EXPECT_EQ(index_sum, 6);
+}
+
+TEST(TupleAlgo, ZipAndParallel) {
+    auto [owner, xs, ys, ids] = Utily::InlineArrays::alloc_uninit<float, double, uint32_t>(1000, 1000, 1000);
+    auto columns = std::make_tuple(xs, ys, ids);
+    auto sums = std::array<double, 3> {};
+    auto columns_and_sums = std::make_tuple(std::tie(xs, sums[0]), std::tie(ys, sums[1]), std::tie(ids, sums[2]));
+
+    Utily::TupleAlgo::parallel_for_each(columns, [](auto column) {
+        std::iota(column.begin(), column.end(), 1);
+    });
+    Utily::TupleAlgo::parallel_for_each(columns_and_sums, [](auto& column_and_sum) {
+        auto& [column, sum] = column_and_sum;
+        sum = std::accumulate(column.begin(), column.end(), 0.0);
+    });
+    EXPECT_EQ(sums, (std::array { 500500.0, 500500.0, 500500.0 }));
+
+    std::array<int, 3> scales = { 1, 2, 3 };
+    auto scale_tuple = std::tuple_cat(scales);
+    auto zipped = Utily::TupleAlgo::zip(columns, scale_tuple);
+    static_assert(std::tuple_size_v<decltype(zipped)> == 3);
+    Utily::TupleAlgo::for_each(zipped, [](auto& pair) {
+        auto& [column, scale] = pair;
+        for (auto& v : column) {
+            v *= static_cast<std::remove_reference_t<decltype(v)>>(scale);
+        }
+    });
+    EXPECT_EQ(xs[9], 10.0f);
+    EXPECT_EQ(ys[9], 20.0);
+    EXPECT_EQ(ids[9], 30u);
+}